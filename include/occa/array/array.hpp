@@ -400,6 +400,12 @@ namespace occa {
     template <class RETTYPE, class TM2, const int idxType2>
     RETTYPE dot(const array<TM2, idxType2> &vec);
 
+    // Computes dot(vec) and l2Norm() in one pass
+    template <class RETTYPE, class TM2, const int idxType2>
+    void dotAndL2Norm(const array<TM2, idxType2> &vec,
+                      RETTYPE &dotValue,
+                      RETTYPE &normValue);
+
     template <class RETTYPE, class TM2, const int idxType2>
     RETTYPE distance(const array<TM2, idxType2> &vec);
 
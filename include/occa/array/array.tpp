@@ -1151,6 +1151,15 @@ namespace occa {
     return linalg::dot<TM,TM2,RETTYPE>(memory_, vec.memory_);
   }
 
+  template <class TM, const int idxType>
+  template <class RETTYPE, class TM2, const int idxType2>
+  void array<TM,idxType>::dotAndL2Norm(const array<TM2, idxType2> &vec,
+                                       RETTYPE &dotValue,
+                                       RETTYPE &normValue) {
+    linalg::dotAndL2Norm<TM,TM2,RETTYPE>(memory_, vec.memory_,
+                                         dotValue, normValue);
+  }
+
   template <class TM, const int idxType>
   template <class RETTYPE, class TM2, const int idxType2>
   RETTYPE array<TM,idxType>::distance(const array<TM2, idxType2> &vec) {
@@ -10,6 +10,9 @@
 
 namespace occa {
   namespace linalg {
+    // Partial results from the first pass of a reduction
+    static const int reductionPartials = 1024;
+
     static const int usedTileSizeCount = 7;
     static const int usedTileSizes[7] = {
       32, 64, 128, 256, 512, 1024, 2048
@@ -40,6 +43,9 @@ namespace occa {
     template <class VTYPE1, class VTYPE2, class RETTYPE>
     kernelBuilder makeLinalgBuilder(const std::string &kernelName);
 
+    template <class RETTYPE>
+    kernelBuilder makePartialsBuilder(const std::string &kernelName);
+
     //---[ Assignment ]-----------------
     template <class VTYPE_OUT>
     void operator_eq(occa::memory vec,
@@ -88,9 +94,9 @@ namespace occa {
     //==================================
 
     //---[ Linear Algebra ]-------------
-    template <class TM>
-    inline std::map<int, TM*>& hostBufferMap() {
-      static std::map<int, TM*> bufferMap;
+    // Reduction buffers are reused across calls on the same device
+    inline hashedMemoryMap& hostBufferMap() {
+      static hashedMemoryMap bufferMap;
       return bufferMap;
     }
 
@@ -99,16 +105,55 @@ namespace occa {
       return bufferMap;
     }
 
+    inline hashedMemoryMap& deviceResultMap() {
+      static hashedMemoryMap bufferMap;
+      return bufferMap;
+    }
+
+    occa::memory reductionBuffer(hashedMemoryMap &bufferMap,
+                                 occa::device device,
+                                 const udim_t bytes,
+                                 const occa::properties &props = occa::properties());
+
+    // Pinned (mapped) host memory for reduction results
     template <class TM>
-    TM *hostReductionBuffer(const int size);
+    TM* hostReductionBuffer(occa::device device,
+                            const int size);
 
     template <class TM>
     occa::memory deviceReductionBuffer(occa::device device,
                                        const int size);
 
+    template <class TM>
+    occa::memory deviceResultBuffer(occa::device device,
+                                    const int size);
+
+    // Runs the first pass of a reduction and returns the
+    //   [reductionPartials] partial results in device memory
     template <class VTYPE, class RETTYPE>
-    RETTYPE* reduce(occa::memory vec,
-                    occa::kernelBuilder &builder);
+    occa::memory reduce(occa::memory vec,
+                        occa::kernelBuilder &builder);
+
+    // Reduces [segments] groups of [reductionPartials] partial results
+    //   on the device and returns one value per group in host memory
+    //
+    // Note: The returned buffer is reused by the next reduction
+    template <class RETTYPE>
+    RETTYPE* finishReduction(occa::kernelBuilder &builder,
+                             occa::memory partials,
+                             const int segments);
+
+    template <class RETTYPE>
+    RETTYPE* sumPartials(occa::memory partials,
+                         const int segments = 1);
+
+    template <class RETTYPE>
+    RETTYPE* maxPartials(occa::memory partials,
+                         const int segments = 1);
+
+    template <class RETTYPE>
+    RETTYPE* minPartials(occa::memory partials,
+                         const int segments = 1);
 
     template <class VTYPE, class RETTYPE>
     RETTYPE l1Norm(occa::memory vec);
@@ -131,6 +176,13 @@ namespace occa {
     template <class VTYPE1, class VTYPE2, class RETTYPE>
     RETTYPE dot(occa::memory vec1, occa::memory vec2);
 
+    // Computes dot(vec1, vec2) and l2Norm(vec1) reading vec1 once
+    template <class VTYPE1, class VTYPE2, class RETTYPE>
+    void dotAndL2Norm(occa::memory vec1,
+                      occa::memory vec2,
+                      RETTYPE &dotValue,
+                      RETTYPE &normValue);
+
     template <class VTYPE1, class VTYPE2, class RETTYPE>
     RETTYPE distance(occa::memory vec1, occa::memory vec2);
 
@@ -30,8 +30,8 @@ namespace occa {
                                      "  VTYPE: '" + primitiveinfo<VTYPE>::name + "',"
                                      "  VTYPE2: '" + primitiveinfo<VTYPE>::name + "',"
                                      "  RETTYPE: '" + primitiveinfo<RETTYPE>::name + "',"
-                                     "  CPU_DOT_OUTER: 1024,"
-                                     "  GPU_DOT_OUTER: 1024,"
+                                     "  CPU_DOT_OUTER: " + toString(reductionPartials) + ","
+                                     "  GPU_DOT_OUTER: " + toString(reductionPartials) + ","
                                      "  GPU_DOT_INNER: 128,"
                                      "}");
     }
@@ -44,8 +44,18 @@ namespace occa {
                                      "  VTYPE: '"   + primitiveinfo<VTYPE1>::name  + "',"
                                      "  VTYPE2: '"  + primitiveinfo<VTYPE2>::name  + "',"
                                      "  RETTYPE: '" + primitiveinfo<RETTYPE>::name + "',"
-                                     "  CPU_DOT_OUTER: 1024,"
-                                     "  GPU_DOT_OUTER: 1024,"
+                                     "  CPU_DOT_OUTER: " + toString(reductionPartials) + ","
+                                     "  GPU_DOT_OUTER: " + toString(reductionPartials) + ","
+                                     "  GPU_DOT_INNER: 128,"
+                                     "}");
+    }
+
+    template <class RETTYPE>
+    kernelBuilder makePartialsBuilder(const std::string &kernelName) {
+      return kernelBuilder::fromFile(env::OCCA_DIR + "include/occa/array/kernels/linalg.okl",
+                                     kernelName,
+                                     "defines: {"
+                                     "  RETTYPE: '" + primitiveinfo<RETTYPE>::name + "',"
                                      "  GPU_DOT_INNER: 128,"
                                      "}");
     }
@@ -171,41 +181,84 @@ namespace occa {
 
     //---[ Linear Algebra ]-------------
     template <class TM>
-    TM *hostReductionBuffer(const int size) {
-      return new TM[size];
+    TM* hostReductionBuffer(occa::device device,
+                            const int size) {
+      const occa::properties props("mapped: true");
+      memory buffer = reductionBuffer(hostBufferMap(),
+                                      device,
+                                      size * sizeof(TM),
+                                      props);
+      return buffer.ptr<TM>(props);
     }
 
     template <class TM>
     occa::memory deviceReductionBuffer(occa::device device,
                                        const int size) {
-      memory &mapBuffer = deviceBufferMap()[hash(device)];
-      const size_t bytes = size * sizeof(TM);
-      // Not initialized or too small
-      if (!mapBuffer.isInitialized() ||
-          (mapBuffer.size() < bytes)) {
-        mapBuffer = device.malloc(bytes);
-        return mapBuffer;
-      }
-      if (mapBuffer.size() == bytes) {
-        return mapBuffer;
-      }
-      return mapBuffer.slice(0, bytes);
+      return reductionBuffer(deviceBufferMap(),
+                             device,
+                             size * sizeof(TM));
     }
 
-    template <class VTYPE, class RETTYPE>
-    RETTYPE* reduce(occa::memory vec,
-                    occa::kernelBuilder &builder,
-                    const int bufferSize) {
+    template <class TM>
+    occa::memory deviceResultBuffer(occa::device device,
+                                    const int size) {
+      return reductionBuffer(deviceResultMap(),
+                             device,
+                             size * sizeof(TM));
+    }
 
+    template <class VTYPE, class RETTYPE>
+    occa::memory reduce(occa::memory vec,
+                        occa::kernelBuilder &builder) {
       device dev = vec.getDevice();
-      RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
-      memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
+      memory partials = deviceReductionBuffer<RETTYPE>(dev, reductionPartials);
       const int entries = vec.size() / sizeof(VTYPE);
       builder.build(dev)(entries,
                          vec,
-                         deviceBuffer);
-      deviceBuffer.copyTo(hostBuffer);
-      return hostBuffer;
+                         partials);
+      return partials;
+    }
+
+    template <class RETTYPE>
+    RETTYPE* finishReduction(occa::kernelBuilder &builder,
+                             occa::memory partials,
+                             const int segments) {
+      device dev = partials.getDevice();
+      memory deviceResult = deviceResultBuffer<RETTYPE>(dev, segments);
+      RETTYPE *hostResult = hostReductionBuffer<RETTYPE>(dev, segments);
+
+      builder.build(dev)(reductionPartials,
+                         segments,
+                         partials,
+                         deviceResult);
+      // Blocking copy, waits for the reduction to finish
+      deviceResult.copyTo(hostResult,
+                          segments * sizeof(RETTYPE));
+      return hostResult;
+    }
+
+    template <class RETTYPE>
+    RETTYPE* sumPartials(occa::memory partials,
+                         const int segments) {
+      static kernelBuilder builder =
+        makePartialsBuilder<RETTYPE>("sumPartials");
+      return finishReduction<RETTYPE>(builder, partials, segments);
+    }
+
+    template <class RETTYPE>
+    RETTYPE* maxPartials(occa::memory partials,
+                         const int segments) {
+      static kernelBuilder builder =
+        makePartialsBuilder<RETTYPE>("maxPartials");
+      return finishReduction<RETTYPE>(builder, partials, segments);
+    }
+
+    template <class RETTYPE>
+    RETTYPE* minPartials(occa::memory partials,
+                         const int segments) {
+      static kernelBuilder builder =
+        makePartialsBuilder<RETTYPE>("minPartials");
+      return finishReduction<RETTYPE>(builder, partials, segments);
     }
 
     template <class VTYPE, class RETTYPE>
@@ -213,13 +266,9 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("l1Norm");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
-      RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
-        ret += partialReduction[i];
-      }
-      delete [] partialReduction;
-      return ret;
+      return *sumPartials<RETTYPE>(
+        reduce<VTYPE, RETTYPE>(vec, builder)
+      );
     }
 
     template <class VTYPE, class RETTYPE>
@@ -227,13 +276,9 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("l2Norm");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
-      RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
-        ret += partialReduction[i];
-      }
-      delete [] partialReduction;
-      return sqrt(ret);
+      return sqrt(*sumPartials<RETTYPE>(
+        reduce<VTYPE, RETTYPE>(vec, builder)
+      ));
     }
 
     template <class VTYPE, class RETTYPE>
@@ -242,24 +287,14 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("lpNorm");
 
-
       device dev = vec.getDevice();
-      const int bufferSize = 1024;
-      RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
-      memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
+      memory partials = deviceReductionBuffer<RETTYPE>(dev, reductionPartials);
       const int entries = vec.size() / sizeof(VTYPE);
       builder.build(dev)(entries,
                          p,
                          vec,
-                         deviceBuffer);
-      dev.finish();
-      deviceBuffer.copyTo(hostBuffer);
-      RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
-        ret += hostBuffer[i];
-      }
-      delete [] hostBuffer;
-      return pow(ret, 1.0/p);
+                         partials);
+      return pow(*sumPartials<RETTYPE>(partials), 1.0/p);
     }
 
     template <class VTYPE, class RETTYPE>
@@ -267,16 +302,9 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("lInfNorm");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
-      RETTYPE ret = partialReduction[0];
-      for (int i = 1; i < 1024; ++i) {
-        const RETTYPE abs_i = partialReduction[i];
-        if (ret < abs_i) {
-          ret = abs_i;
-        }
-      }
-      delete [] partialReduction;
-      return ret;
+      return *maxPartials<RETTYPE>(
+        reduce<VTYPE, RETTYPE>(vec, builder)
+      );
     }
 
     template <class VTYPE, class RETTYPE>
@@ -284,15 +312,9 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("vecMax");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
-      RETTYPE ret = partialReduction[0];
-      for (int i = 1; i < 1024; ++i) {
-        if (ret < partialReduction[i]) {
-          ret = partialReduction[i];
-        }
-      }
-      delete [] partialReduction;
-      return ret;
+      return *maxPartials<RETTYPE>(
+        reduce<VTYPE, RETTYPE>(vec, builder)
+      );
     }
 
     template <class VTYPE, class RETTYPE>
@@ -300,15 +322,9 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("vecMin");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
-      RETTYPE ret = partialReduction[0];
-      for (int i = 1; i < 1024; ++i) {
-        if (ret > partialReduction[i]) {
-          ret = partialReduction[i];
-        }
-      }
-      delete [] partialReduction;
-      return ret;
+      return *minPartials<RETTYPE>(
+        reduce<VTYPE, RETTYPE>(vec, builder)
+      );
     }
 
     template <class VTYPE1, class VTYPE2, class RETTYPE>
@@ -320,22 +336,38 @@ namespace occa {
                  vec1.getDevice() == vec2.getDevice());
 
       device dev = vec1.getDevice();
-      const int bufferSize = 1024;
-      RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
-      memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
+      memory partials = deviceReductionBuffer<RETTYPE>(dev, reductionPartials);
       const int entries = vec1.size() / sizeof(VTYPE1);
       builder.build(dev)(entries,
                          vec1,
                          vec2,
-                         deviceBuffer);
-      dev.finish();
-      deviceBuffer.copyTo(hostBuffer);
-      RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
-        ret += hostBuffer[i];
-      }
-      delete [] hostBuffer;
-      return ret;
+                         partials);
+      return *sumPartials<RETTYPE>(partials);
+    }
+
+    template <class VTYPE1, class VTYPE2, class RETTYPE>
+    void dotAndL2Norm(occa::memory vec1,
+                      occa::memory vec2,
+                      RETTYPE &dotValue,
+                      RETTYPE &normValue) {
+      static kernelBuilder builder =
+        makeLinalgBuilder<VTYPE1, VTYPE2, RETTYPE>("dotAndL2Norm");
+
+      OCCA_ERROR("Vectors must be in the same device",
+                 vec1.getDevice() == vec2.getDevice());
+
+      // Partials for the dot product are followed by the norm partials
+      device dev = vec1.getDevice();
+      memory partials = deviceReductionBuffer<RETTYPE>(dev, 2 * reductionPartials);
+      const int entries = vec1.size() / sizeof(VTYPE1);
+      builder.build(dev)(entries,
+                         vec1,
+                         vec2,
+                         partials);
+
+      const RETTYPE *values = sumPartials<RETTYPE>(partials, 2);
+      dotValue = values[0];
+      normValue = sqrt(values[1]);
     }
 
     template <class VTYPE1, class VTYPE2, class RETTYPE>
@@ -347,22 +379,13 @@ namespace occa {
                  vec1.getDevice() == vec2.getDevice());
 
       device dev = vec1.getDevice();
-      const int bufferSize = 1024;
-      RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
-      memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
+      memory partials = deviceReductionBuffer<RETTYPE>(dev, reductionPartials);
       const int entries = vec1.size() / sizeof(VTYPE1);
       builder.build(dev)(entries,
                          vec1,
                          vec2,
-                         deviceBuffer);
-      dev.finish();
-      deviceBuffer.copyTo(hostBuffer);
-      RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
-        ret += hostBuffer[i];
-      }
-      delete [] hostBuffer;
-      return sqrt(ret);
+                         partials);
+      return sqrt(*sumPartials<RETTYPE>(partials));
     }
 
     template <class VTYPE, class RETTYPE>
@@ -370,13 +393,9 @@ namespace occa {
       static kernelBuilder builder =
         makeLinalgBuilder<VTYPE, RETTYPE>("sum");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
-      RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
-        ret += partialReduction[i];
-      }
-      delete [] partialReduction;
-      return ret;
+      return *sumPartials<RETTYPE>(
+        reduce<VTYPE, RETTYPE>(vec, builder)
+      );
     }
 
     template <class TYPE_A, class VTYPE_X, class VTYPE_Y>
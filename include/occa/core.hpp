@@ -1,12 +1,17 @@
 #ifndef OCCA_CORE_HEADER
 #define OCCA_CORE_HEADER
 
+#include <occa/core/asyncKernel.hpp>
 #include <occa/core/base.hpp>
 #include <occa/core/device.hpp>
+#include <occa/core/graph.hpp>
 #include <occa/core/kernel.hpp>
 #include <occa/core/kernelArg.hpp>
+#include <occa/core/kernelBuild.hpp>
 #include <occa/core/kernelBuilder.hpp>
+#include <occa/core/launchPlan.hpp>
 #include <occa/core/memory.hpp>
+#include <occa/core/memoryPool.hpp>
 #include <occa/core/scope.hpp>
 #include <occa/core/stream.hpp>
 #include <occa/core/streamTag.hpp>
@@ -0,0 +1,58 @@
+#ifndef OCCA_CORE_ASYNCKERNEL_HEADER
+#define OCCA_CORE_ASYNCKERNEL_HEADER
+
+#include <atomic>
+
+#include <occa/core/kernel.hpp>
+#include <occa/core/kernelBuild.hpp>
+
+namespace occa {
+  // Kernel handle returned by device::buildKernelAsync
+  //   Launches use the fallback kernel (if any) until the
+  //   optimized build finishes, then swap to the optimized kernel
+  class asyncModeKernel_t : public modeKernel_t {
+  private:
+    kernelFuture future;
+    kernelFuture fallbackFuture;
+
+    occa::kernel optimizedKernel;
+    occa::kernel fallbackKernel;
+
+    std::atomic<modeKernel_t*> activeKernel;
+    bool usingOptimizedKernel;
+
+  public:
+    asyncModeKernel_t(modeDevice_t *modeDevice_,
+                      const std::string &name_,
+                      const std::string &sourceFilename_,
+                      const occa::properties &properties_,
+                      kernelFuture future_,
+                      kernelFuture fallbackFuture_);
+
+    ~asyncModeKernel_t();
+
+    bool isOptimized() const;
+
+    // Blocks until the optimized kernel is loaded
+    modeKernel_t* getOptimizedKernel();
+
+    // Picks the kernel for the next launch without waiting
+    //   on the optimized build if a fallback is available
+    modeKernel_t* getLaunchKernel();
+
+    int maxDims() const;
+    dim maxOuterDims() const;
+    dim maxInnerDims() const;
+
+    const lang::kernelMetadata_t& getMetadata() const;
+
+    void setupRun();
+    void setupValidatedRun();
+    void run() const;
+
+  private:
+    void swapToOptimizedKernel();
+  };
+}
+
+#endif
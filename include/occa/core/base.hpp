@@ -43,6 +43,9 @@ namespace occa {
   void setStream(stream s);
 
   streamTag tagStream();
+
+  void beginCapture(const occa::properties &props = occa::properties());
+  graph endCapture();
   //====================================
 
   //---[ Kernel Functions ]-------------
@@ -57,6 +60,12 @@ namespace occa {
   kernel buildKernelFromBinary(const std::string &filename,
                                const std::string &kernelName,
                                const occa::properties &props = occa::properties());
+
+  kernelFutureVector buildKernels(const kernelBuildRequestVector &requests);
+
+  kernel buildKernelAsync(const std::string &filename,
+                          const std::string &kernelName,
+                          const occa::properties &props = occa::properties());
   //====================================
 
   //---[ Memory Functions ]-------------
@@ -4,13 +4,17 @@
 #include <iostream>
 #include <sstream>
 
+#include <occa/core/graph.hpp>
 #include <occa/core/kernel.hpp>
+#include <occa/core/kernelBuild.hpp>
 #include <occa/core/memory.hpp>
+#include <occa/core/memoryPool.hpp>
 #include <occa/core/stream.hpp>
 #include <occa/defines.hpp>
 #include <occa/dtype.hpp>
 #include <occa/io/output.hpp>
 #include <occa/tools/gc.hpp>
+#include <occa/tools/threadPool.hpp>
 #include <occa/tools/uva.hpp>
 
 namespace occa {
@@ -19,10 +23,12 @@ namespace occa {
   class modeStreamTag_t; class streamTag;
   class deviceInfo;
 
-  typedef std::map<std::string, kernel>   cachedKernelMap;
+  typedef std::map<std::string, std::vector<modeKernel_t*>> cachedKernelMap;
   typedef cachedKernelMap::iterator       cachedKernelMapIterator;
   typedef cachedKernelMap::const_iterator cCachedKernelMapIterator;
 
+  typedef std::map<std::string, kernelBuildStatePtr> kernelBuildStateMap;
+
   //---[ modeDevice_t ]---------------------
   class modeDevice_t {
   public:
@@ -35,21 +41,41 @@ namespace occa {
     gc::ring_t<modeMemory_t> memoryRing;
     gc::ring_t<modeStream_t> streamRing;
     gc::ring_t<modeStreamTag_t> streamTagRing;
+    gc::ring_t<modeGraph_t> graphRing;
 
-    ptrRangeMap uvaMap;
-    memoryVector uvaStaleMemory;
+    // UVA memory written by kernels, synced back to the host in finish()
+    staleMemoryList uvaStaleMemory;
 
     stream currentStream;
     std::vector<modeStream_t*> streams;
 
+    // Launches and copies are recorded instead of run while capturing
+    modeGraph_t *capturingGraph;
+
     udim_t bytesAllocated;
+    udim_t maxBytesAllocated;
 
+    // Set with the [memory_pool] device properties, NULL if disabled
+    memoryPool_t *memoryPool;
+
+    // Kernels sharing a build, keyed by getKernelHash()
+    // The cache doesn't own the kernels, an entry is removed when the
+    //   last kernel sharing its build is freed
     cachedKernelMap cachedKernels;
+    // Full kernel hashes keyed by getKernelHash() of the build request,
+    //   see device::kernelRequestHash()
+    std::map<std::string, hash_t> kernelRequestHashes;
+    udim_t kernelCacheHits;
+    udim_t kernelCacheMisses;
+
+    // Compiles running in the background, keyed by kernel hash
+    threadPool *compilePool;
+    kernelBuildStateMap pendingKernelBuilds;
 
     modeDevice_t(const occa::properties &properties_);
 
     template <class modeType_t>
-    void freeRing(gc::ring_t<modeType_t> ring) {
+    void freeRing(gc::ring_t<modeType_t> &ring) {
       while (ring.head) {
         modeType_t *ptr = (modeType_t*) ring.head;
         ring.removeRef(ptr);
@@ -77,6 +103,9 @@ namespace occa {
     void addStreamTagRef(modeStreamTag_t *streamTag);
     void removeStreamTagRef(modeStreamTag_t *streamTag);
 
+    void addGraphRef(modeGraph_t *graph);
+    void removeGraphRef(modeGraph_t *graph);
+
     //---[ Virtual Methods ]------------
     virtual ~modeDevice_t() = 0;
 
@@ -95,6 +124,16 @@ namespace occa {
     virtual void waitFor(streamTag tag) = 0;
     virtual double timeBetween(const streamTag &startTag,
                                const streamTag &endTag) = 0;
+
+    // Modes with native graph support can override how graphs replay
+    virtual modeGraph_t* createGraph(const occa::properties &props);
+    //  |===============================
+
+    //  |---[ Memory Pool ]-------------
+    // Modes can override how freed allocations are cached
+    virtual memoryPool_t* createMemoryPool(const occa::properties &props);
+
+    void setupMemoryPool();
     //  |===============================
 
     //  |---[ Kernel ]------------------
@@ -111,11 +150,40 @@ namespace occa {
 
     std::string getKernelHash(modeKernel_t *kernel);
 
-    kernel& getCachedKernel(const hash_t &kernelHash,
-                            const std::string &kernelName);
+    modeKernel_t* findCachedKernel(const hash_t &kernelHash,
+                                   const std::string &kernelName);
+
+    // Cache hits return a clone of the cached kernel so each build
+    //   has its own launch state and can be freed on its own
+    modeKernel_t* cloneCachedKernel(const hash_t &kernelHash,
+                                    const std::string &kernelName);
+
+    // Same as cloneCachedKernel() but counts the cache hit or miss
+    modeKernel_t* getCachedKernel(const hash_t &kernelHash,
+                                  const std::string &kernelName);
+
+    // Same as cloneCachedKernel() for a build request seen before,
+    //   only hits are counted since misses go on to hash the source
+    modeKernel_t* getRequestedKernel(const hash_t &requestHash,
+                                     const std::string &kernelName);
+
+    void addKernelRequest(const hash_t &requestHash,
+                          modeKernel_t *kernel);
 
+    void addCachedKernel(modeKernel_t *kernel);
     void removeCachedKernel(modeKernel_t *kernel);
 
+    threadPool& getCompilePool();
+
+    kernelBuildStatePtr getPendingKernelBuild(const hash_t &kernelHash);
+    void addPendingKernelBuild(kernelBuildStatePtr state);
+    void removePendingKernelBuild(kernelBuildState_t *state);
+
+    virtual modeKernelBuild_t* startKernelBuild(const std::string &filename,
+                                                const std::string &kernelName,
+                                                const hash_t hash,
+                                                const occa::properties &props);
+
     virtual modeKernel_t* buildKernel(const std::string &filename,
                                       const std::string &kernelName,
                                       const hash_t hash,
@@ -160,6 +228,12 @@ namespace occa {
     void setModeDevice(modeDevice_t *modeDevice_);
     void removeDeviceRef();
 
+    // Starts a build that finds, hashes and parses the source
+    //   in the compile pool instead of the calling thread
+    kernelFuture startPooledKernelBuild(const std::string &filename,
+                                        const std::string &kernelName,
+                                        const occa::properties &props) const;
+
   public:
     void dontUseRefs();
 
@@ -191,6 +265,13 @@ namespace occa {
 
     udim_t memorySize() const;
     udim_t memoryAllocated() const;
+    udim_t maxMemoryAllocated() const;
+
+    // Freed allocations kept by the memory pool for reuse
+    udim_t memoryPoolBytes() const;
+    udim_t memoryPoolHits() const;
+    udim_t memoryPoolMisses() const;
+    void trimMemoryPool();
 
     void finish();
 
@@ -206,6 +287,12 @@ namespace occa {
     void waitFor(streamTag tag);
     double timeBetween(const streamTag &startTag,
                        const streamTag &endTag);
+
+    // Records kernel launches, copies and stream tag dependencies
+    //   until endCapture() instead of running them
+    void beginCapture(const occa::properties &props = occa::properties());
+    occa::graph endCapture();
+    bool isCapturing() const;
     //  |===============================
 
     //  |---[ Kernel ]------------------
@@ -214,7 +301,13 @@ namespace occa {
                          occa::properties &kernelProps,
                          hash_t &kernelHash) const;
 
-    hash_t applyDependencyHash(const hash_t &kernelHash) const;
+    // Only reads the cache, safe to call from the compile pool
+    static hash_t applyDependencyHash(const hash_t &kernelHash);
+
+    // Hash of a build request, which only depends on what was passed
+    //   to the build and not on the files it reads
+    hash_t kernelRequestHash(const hash_t &sourceHash,
+                             const occa::properties &props) const;
 
     occa::kernel buildKernel(const std::string &filename,
                              const std::string &kernelName,
@@ -224,11 +317,28 @@ namespace occa {
                                        const std::string &kernelName,
                                        const occa::properties &props = occa::properties()) const;
 
+    kernelFuture startKernelBuild(const std::string &filename,
+                                  const std::string &kernelName,
+                                  const occa::properties &props = occa::properties()) const;
+
+    kernelFutureVector buildKernels(const kernelBuildRequestVector &requests) const;
+
+    // Returns without reading the source, finding, hashing and parsing it
+    //   happen in the compile pool along with the compile
+    //   Build errors are thrown by the first launch
+    occa::kernel buildKernelAsync(const std::string &filename,
+                                  const std::string &kernelName,
+                                  const occa::properties &props = occa::properties()) const;
+
     occa::kernel buildKernelFromBinary(const std::string &filename,
                                        const std::string &kernelName,
                                        const occa::properties &props = occa::properties()) const;
 
     void loadKernels(const std::string &library = "");
+
+    // Number of buildKernel calls served from the in-memory kernel cache
+    udim_t kernelCacheHits() const;
+    udim_t kernelCacheMisses() const;
     //  |===============================
 
     //  |---[ Memory ]------------------
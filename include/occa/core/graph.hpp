@@ -0,0 +1,187 @@
+#ifndef OCCA_CORE_GRAPH_HEADER
+#define OCCA_CORE_GRAPH_HEADER
+
+#include <map>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/core/kernel.hpp>
+#include <occa/core/kernelArg.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/core/stream.hpp>
+#include <occa/tools/gc.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  class modeDevice_t; class device;
+  class modeKernel_t;
+  class modeMemory_t;
+  class modeStream_t;
+  class modeStreamTag_t;
+  class modeGraph_t; class graph;
+
+  //---[ graphNode ]--------------------
+  namespace graphNodeType {
+    static const int kernel = (1 << 0);
+    static const int copy   = (1 << 1);
+  }
+
+  class graphNode {
+  public:
+    int type;
+    modeStream_t *modeStream;
+
+    // Earlier nodes that need to finish before this node starts
+    //   Nodes on the same stream depend on the previous node, nodes
+    //   on other streams only through waitFor(tag)
+    std::vector<int> dependencies;
+
+    // Kernel launch
+    modeKernel_t *modeKernel;
+    std::vector<kernelArgData> arguments;
+    dim outerDims, innerDims;
+
+    // Copy, the memory is NULL when copying to/from a host pointer
+    modeMemory_t *destMemory;
+    modeMemory_t *srcMemory;
+    void *destPtr;
+    const void *srcPtr;
+    udim_t bytes;
+    udim_t destOffset, srcOffset;
+    occa::properties props;
+
+    // Handles keep what the node uses alive until the graph is freed,
+    //   explicit free() calls NULL them and the graph can't be run
+    occa::stream stream;
+    occa::kernel kernel;
+    std::vector<occa::memory> memories;
+
+    graphNode();
+
+    bool isValid() const;
+  };
+  //====================================
+
+  //---[ modeGraph_t ]------------------
+  class modeGraph_t : public gc::ringEntry_t {
+  public:
+    occa::properties properties;
+
+    gc::ring_t<graph> graphRing;
+
+    modeDevice_t *modeDevice;
+
+    // Nodes are stored in capture order, which is a valid launch order
+    std::vector<graphNode> nodes;
+
+  private:
+    // Only used while capturing
+    std::map<modeStream_t*, int> lastStreamNodes;
+    std::map<modeStream_t*, std::vector<int> > pendingStreamWaits;
+    std::map<modeStreamTag_t*, int> tagNodes;
+
+  public:
+    modeGraph_t(modeDevice_t *modeDevice_,
+                const occa::properties &properties_);
+
+    void dontUseRefs();
+    void addGraphRef(graph *g);
+    void removeGraphRef(graph *g);
+    bool needsFree() const;
+
+    // False if a captured kernel, memory or stream was freed
+    bool isValid() const;
+
+    //---[ Capture ]--------------------
+    void captureKernel(modeKernel_t &modeKernel);
+
+    void captureCopy(modeMemory_t *destMemory,
+                     void *destPtr,
+                     modeMemory_t *srcMemory,
+                     const void *srcPtr,
+                     const udim_t bytes,
+                     const udim_t destOffset,
+                     const udim_t srcOffset,
+                     const occa::properties &props);
+
+    void captureTag(modeStreamTag_t *modeStreamTag);
+    void captureWaitFor(modeStreamTag_t *modeStreamTag);
+
+    void endCapture();
+
+  private:
+    modeStream_t* getCurrentModeStream() const;
+    void addNode(graphNode &node);
+
+  protected:
+    // Launches a single node on the current stream
+    void runNode(graphNode &node);
+    //==================================
+
+  public:
+    //---[ Virtual Methods ]------------
+    virtual ~modeGraph_t();
+
+    // Called once after capture ends so modes can prepare the replay
+    virtual void finishCapture();
+
+    // Replays the nodes in capture order on the streams they were
+    //   captured on, cross-stream dependencies use stream tags
+    virtual void run();
+    //==================================
+  };
+  //====================================
+
+  //---[ graph ]------------------------
+  // Launches and copies recorded between device::beginCapture()
+  //   and device::endCapture(), replayed with run()
+  //
+  // The graph keeps the kernels, memory and streams it uses alive,
+  //   run() throws if one of them was freed with free()
+  class graph : public gc::ringEntry_t {
+    friend class occa::modeGraph_t;
+
+  private:
+    modeGraph_t *modeGraph;
+
+  public:
+    graph();
+    graph(modeGraph_t *modeGraph_);
+
+    graph(const graph &g);
+    graph& operator = (const graph &g);
+    ~graph();
+
+  private:
+    void assertInitialized() const;
+    void setModeGraph(modeGraph_t *modeGraph_);
+    void removeGraphRef();
+
+  public:
+    void dontUseRefs();
+
+    bool isInitialized() const;
+
+    modeGraph_t* getModeGraph() const;
+    modeDevice_t* getModeDevice() const;
+
+    occa::device getDevice() const;
+
+    const std::string& mode() const;
+    const occa::properties& properties() const;
+
+    int size() const;
+
+    void run() const;
+    void operator () () const;
+
+    bool operator == (const occa::graph &other) const;
+    bool operator != (const occa::graph &other) const;
+
+    void free();
+  };
+  //====================================
+}
+
+#endif
@@ -17,6 +17,7 @@ namespace occa {
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class kernelBuilder;
+  class launchPlan;
 
   namespace lang {
     class parser_t;
@@ -46,6 +47,12 @@ namespace occa {
     std::vector<kernelArgData> arguments;
     lang::kernelMetadata_t metadata;
 
+    // Argument types from the last launch that passed type validation,
+    //   launches with the same argument types skip validation
+    bool typeValidation;
+    bool hasValidatedArgTypes;
+    std::vector<const void*> validatedArgTypes;
+
     // References
     gc::ring_t<kernel> kernelRing;
 
@@ -62,13 +69,28 @@ namespace occa {
     void assertArgumentLimit() const;
     void assertArgInDevice(const kernelArgData &arg) const;
 
-    void setArguments(kernelArg *args,
+    void setArguments(const kernelArg * const *args,
                       const int count);
     void pushArgument(const kernelArg &arg);
 
     void setSourceMetadata(lang::parser_t &parser);
 
-    void setupRun();
+    bool validatesArgTypes() const;
+    bool argTypesAreValidated() const;
+    void validateArgTypes();
+
+    void setupArgumentsForRun();
+
+    virtual void setupRun();
+
+    // Launch plans validate their arguments when they are bound
+    virtual void setupValidatedRun();
+
+    // Returns a new kernel with its own launch state that shares the
+    //   loaded binary, or NULL if the mode can't share it
+    // Kernels that can't be cloned are rebuilt on every build call,
+    //   the in-memory kernel cache only has hits for modes that clone
+    virtual modeKernel_t* clone() const;
 
     //---[ Virtual Methods ]------------
     virtual ~modeKernel_t() = 0;
@@ -139,6 +161,9 @@ namespace occa {
 
 #include "kernelOperators.hpp"
 
+    // Binds arguments once for repeated launches
+#include "kernelBindOperators.hpp"
+
     void free();
   };
   //====================================
@@ -1,6 +1,7 @@
 #ifndef OCCA_CORE_KERNELARG_HEADER
 #define OCCA_CORE_KERNELARG_HEADER
 
+#include <memory>
 #include <vector>
 
 #include <occa/defines.hpp>
@@ -10,14 +11,15 @@ namespace occa {
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class kernelArgData;
-
-  typedef std::vector<kernelArgData> kArgVector;
+  class dtype_t;
 
   //---[ KernelArg ]--------------------
   namespace kArgInfo {
-    static const char none       = 0;
-    static const char usePointer = (1 << 0);
-    static const char isNull     = (1 << 1);
+    static const char none          = 0;
+    static const char usePointer    = (1 << 0);
+    static const char isNull        = (1 << 1);
+    // [data.void_] points at a value owned by the caller (e.g. type2<TM>)
+    static const char pointsToValue = (1 << 2);
   }
 
   class nullKernelArg_t {
@@ -47,10 +49,15 @@ namespace occa {
   class kernelArgData {
   public:
     occa::modeMemory_t *modeMemory;
+    // Set for memory views, which can have a different dtype than
+    //   the memory they point to
+    const dtype_t *dtype;
 
     kernelArgData_t data;
     udim_t size;
     char info;
+    // Copy of a [pointsToValue] value, shared between copies of the argument
+    std::shared_ptr<std::vector<char>> ownedValue;
 
     kernelArgData();
     kernelArgData(const kernelArgData &other);
@@ -59,14 +66,57 @@ namespace occa {
 
     occa::modeDevice_t* getModeDevice() const;
     occa::modeMemory_t* getModeMemory() const;
+    const dtype_t* getDtype() const;
 
     void* ptr() const;
 
     bool isNull() const;
 
+    // Copies the value the argument points to so the argument can
+    //   outlive the caller's object, e.g. for launches that run later
+    void ownValue();
+
     void setupForKernelCall(const bool isConst) const;
   };
 
+  // A kernelArg almost always holds a single value, keep a few inline
+  //   so building arguments for a launch doesn't touch the heap
+  class kArgVector {
+  private:
+    static const int inlineCapacity = 2;
+
+    kernelArgData inlineArgs[inlineCapacity];
+    std::vector<kernelArgData> extraArgs;
+    int count;
+
+  public:
+    kArgVector();
+
+    inline size_t size() const {
+      return (size_t) count;
+    }
+
+    inline bool empty() const {
+      return !count;
+    }
+
+    inline kernelArgData& operator [] (const int index) {
+      return ((index < inlineCapacity)
+              ? inlineArgs[index]
+              : extraArgs[index - inlineCapacity]);
+    }
+
+    inline const kernelArgData& operator [] (const int index) const {
+      return ((index < inlineCapacity)
+              ? inlineArgs[index]
+              : extraArgs[index - inlineCapacity]);
+    }
+
+    void push_back(const kernelArgData &arg);
+
+    void clear();
+  };
+
   class kernelArg {
   public:
     kArgVector args;
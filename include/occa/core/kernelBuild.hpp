@@ -0,0 +1,139 @@
+#ifndef OCCA_CORE_KERNELBUILD_HEADER
+#define OCCA_CORE_KERNELBUILD_HEADER
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/core/kernel.hpp>
+#include <occa/tools/properties.hpp>
+
+namespace occa {
+  class modeKernel_t; class kernel;
+  class modeDevice_t; class device;
+  class kernelBuildState_t;
+
+  typedef std::shared_ptr<kernelBuildState_t> kernelBuildStatePtr;
+
+  //---[ kernelBuildRequest ]-----------
+  class kernelBuildRequest {
+  public:
+    std::string filename;
+    std::string kernelName;
+    occa::properties props;
+
+    kernelBuildRequest();
+
+    kernelBuildRequest(const std::string &filename_,
+                       const std::string &kernelName_,
+                       const occa::properties &props_ = occa::properties());
+  };
+
+  typedef std::vector<kernelBuildRequest> kernelBuildRequestVector;
+  //====================================
+
+  //---[ modeKernelBuild_t ]------------
+  // Mode-specific state of a kernel build split into:
+  //   - compile(): Runs in the device compile pool
+  //                Must not throw or touch shared device state
+  //   - finish():  Runs in the thread resolving the build
+  class modeKernelBuild_t {
+  public:
+    modeKernelBuild_t();
+    virtual ~modeKernelBuild_t();
+
+    virtual bool needsCompile() const;
+    virtual void compile();
+
+    virtual modeKernel_t* finish() = 0;
+  };
+
+  // Default for modes that can't split compilation from loading
+  class deferredKernelBuild_t : public modeKernelBuild_t {
+  public:
+    modeDevice_t *modeDevice;
+    std::string filename;
+    std::string kernelName;
+    hash_t kernelHash;
+    occa::properties kernelProps;
+
+    deferredKernelBuild_t(modeDevice_t *modeDevice_,
+                          const std::string &filename_,
+                          const std::string &kernelName_,
+                          const hash_t kernelHash_,
+                          const occa::properties &kernelProps_);
+
+    virtual modeKernel_t* finish();
+  };
+  //====================================
+
+  //---[ kernelBuildState_t ]-----------
+  class kernelBuildState_t {
+  public:
+    modeDevice_t *modeDevice;
+    modeKernelBuild_t *build;
+
+    // Build with the same kernel hash that was started first
+    kernelBuildStatePtr sharedBuild;
+
+    // Build request
+    std::string filename;
+    std::string kernelName;
+    occa::properties props;
+    hash_t requestHash;
+    hash_t kernelHash;
+
+    // Pooled builds find and hash the source in setup(), which starts
+    //   [kernelHash] from the device and property hashes
+    //   occa::settings() are per thread, [settings] are the caller's
+    bool setupInPool;
+    occa::properties kernelProps;
+    occa::properties settings;
+    std::exception_ptr error;
+
+    std::mutex mutex;
+    std::condition_variable compiledCondition;
+    bool compiled;
+    bool finished;
+    occa::kernel kernel;
+
+    kernelBuildState_t(modeDevice_t *modeDevice_,
+                       modeKernelBuild_t *build_);
+    ~kernelBuildState_t();
+
+    bool isCompiled();
+    void waitForCompile();
+
+    void setup();
+    void compile();
+    occa::kernel finish();
+  };
+  //====================================
+
+  //---[ kernelFuture ]-----------------
+  class kernelFuture {
+  private:
+    kernelBuildStatePtr state;
+
+  public:
+    kernelFuture();
+    kernelFuture(kernelBuildStatePtr state_);
+
+    bool isInitialized() const;
+
+    // Returns true if get() won't wait on the compiler
+    bool isReady() const;
+    void wait() const;
+
+    // Loads the compiled kernel on first call
+    occa::kernel get() const;
+  };
+
+  typedef std::vector<kernelFuture> kernelFutureVector;
+  //====================================
+}
+
+#endif
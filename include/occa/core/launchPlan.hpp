@@ -0,0 +1,54 @@
+#ifndef OCCA_CORE_LAUNCHPLAN_HEADER
+#define OCCA_CORE_LAUNCHPLAN_HEADER
+
+#include <vector>
+
+#include <occa/core/kernel.hpp>
+#include <occa/core/kernelArg.hpp>
+
+namespace occa {
+  // Kernel arguments bound once with kernel::bind(...)
+  //   Arguments are validated when they are bound, launches only
+  //   copy the bound arguments and run the kernel
+  //
+  //   occa::launchPlan step = addVectors.bind(entries, o_a, o_b, o_ab);
+  //   for (int i = 0; i < steps; ++i) {
+  //     step.setArg(0, entries);
+  //     step();
+  //   }
+  class launchPlan {
+  private:
+    occa::kernel boundKernel;
+    std::vector<kernelArgData> arguments;
+
+  public:
+    launchPlan();
+
+    launchPlan(const occa::kernel &kernel_,
+               const kernelArg * const *args,
+               const int count);
+
+    launchPlan(const launchPlan &other);
+    launchPlan& operator = (const launchPlan &other);
+
+  private:
+    modeKernel_t* getLaunchKernel() const;
+
+  public:
+    bool isInitialized() const;
+
+    occa::kernel getKernel() const;
+
+    int argumentCount() const;
+
+    // Replaces a bound argument
+    //   Updating a value with one of the same size skips validation
+    void setArg(const int index, const kernelArg &arg);
+
+    void run() const;
+
+    void operator () () const;
+  };
+}
+
+#endif
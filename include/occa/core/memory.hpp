@@ -8,9 +8,10 @@
 #include <occa/io/output.hpp>
 #include <occa/tools/gc.hpp>
 #include <occa/tools/properties.hpp>
+#include <occa/tools/uva.hpp>
 
 namespace occa {
-  class modeMemory_t; class memory;
+  class modeMemory_t; class memory; class memoryView;
   class modeDevice_t; class device;
   class kernelArg;
 
@@ -42,6 +43,21 @@ namespace occa {
     udim_t size;
     bool isOrigin;
 
+    // Bytes reserved by the device memory pool, 0 if not pooled
+    udim_t poolBytes;
+
+    // Links for modeDevice_t::uvaStaleMemory
+    modeMemory_t *prevStale;
+    modeMemory_t *nextStale;
+
+    // Set with the [track_dirty_ranges] memory property for UVA memory
+    //   on devices with a separate memory space
+    bool tracksDirtyRanges;
+    // Host writes which aren't on the device yet
+    dirtyRangeSet hostDirtyRanges;
+    // Device writes which aren't on the host yet
+    dirtyRangeSet deviceDirtyRanges;
+
     modeMemory_t(modeDevice_t *modeDevice_,
                  udim_t size_,
                  const occa::properties &properties_);
@@ -49,16 +65,31 @@ namespace occa {
     void dontUseRefs();
     void addMemoryRef(memory *mem);
     void removeMemoryRef(memory *mem);
+    void removeMemoryRefs();
     bool needsFree() const;
 
     bool isManaged() const;
     bool inDevice() const;
     bool isStale() const;
 
+    // No-ops unless dirty ranges are tracked
+    void markHostDirty(const udim_t offset,
+                       const udim_t bytes);
+    void markDeviceDirty(const udim_t offset,
+                         const udim_t bytes);
+
+    // Copies the dirty ranges overlapping [offset, offset + bytes)
+    void syncDirtyRangesToDevice(const udim_t offset,
+                                 const udim_t bytes);
+    void syncDirtyRangesToHost(const udim_t offset,
+                               const udim_t bytes,
+                               const occa::properties &props = occa::properties());
+
     //---[ Virtual Methods ]------------
     virtual ~modeMemory_t() = 0;
 
-    virtual kernelArg makeKernelArg() const = 0;
+    // Kernel argument for the memory starting at [offset] bytes
+    virtual kernelArg makeKernelArg(const udim_t offset = 0) const = 0;
 
     virtual modeMemory_t* addOffset(const dim_t offset) = 0;
 
@@ -119,6 +150,9 @@ namespace occa {
     memory(void *uvaPtr);
     memory(modeMemory_t *modeMemory_);
 
+    // Creates an unowned memory object for the view's range
+    memory(const memoryView &view);
+
     memory(const memory &m);
     memory& operator = (const memory &m);
     ~memory();
@@ -191,11 +225,11 @@ namespace occa {
     bool operator == (const occa::memory &other) const;
     bool operator != (const occa::memory &other) const;
 
-    occa::memory operator + (const dim_t offset) const;
+    occa::memoryView operator + (const dim_t offset) const;
     occa::memory& operator += (const dim_t offset);
 
-    occa::memory slice(const dim_t offset,
-                       const dim_t count = -1) const;
+    occa::memoryView slice(const dim_t offset,
+                           const dim_t count = -1) const;
 
     void copyFrom(const void *src,
                   const dim_t bytes = -1,
@@ -243,6 +277,67 @@ namespace occa {
   extern memory null;
   //====================================
 
+
+  //---[ memoryView ]-------------------
+  // A range of [memory] that shares its modeMemory_t
+  //   - Slicing a view is a value operation, nothing is allocated
+  //   - Views can be passed directly as kernel arguments
+  //   - Offsets and counts are in [dtype] entries, sizes are in bytes
+  class memoryView {
+  private:
+    occa::memory memory_;
+    udim_t offset_;
+    udim_t size_;
+    const dtype_t *dtype_;
+
+  public:
+    memoryView();
+    memoryView(const occa::memory &memory__);
+    memoryView(const occa::memory &memory__,
+               const udim_t offset__,
+               const udim_t size__,
+               const dtype_t &dtype__);
+
+    bool isInitialized() const;
+
+    const occa::memory& getMemory() const;
+    modeMemory_t* getModeMemory() const;
+    occa::device getDevice() const;
+
+    operator kernelArg() const;
+
+    const dtype_t& dtype() const;
+
+    udim_t offset() const;
+    udim_t size() const;
+    udim_t length() const;
+
+    template <class TM = void>
+    TM* ptr() const;
+
+    bool operator == (const occa::memoryView &other) const;
+    bool operator != (const occa::memoryView &other) const;
+
+    occa::memoryView operator + (const dim_t offset) const;
+    occa::memoryView& operator += (const dim_t offset);
+
+    occa::memoryView slice(const dim_t offset,
+                           const dim_t count = -1) const;
+
+    occa::memoryView as(const dtype_t &dtype__) const;
+
+    void copyFrom(const void *src,
+                  const dim_t bytes = -1,
+                  const dim_t offset = 0,
+                  const occa::properties &props = occa::properties());
+
+    void copyTo(void *dest,
+                const dim_t bytes = -1,
+                const dim_t offset = 0,
+                const occa::properties &props = occa::properties()) const;
+  };
+  //====================================
+
   std::ostream& operator << (std::ostream &out,
                            const occa::memory &memory);
 
@@ -18,4 +18,12 @@ namespace occa {
   const TM* memory::ptr(const occa::properties &props) const {
     return (const TM*) ptr<void>(props);
   }
+
+  template <class TM>
+  TM* memoryView::ptr() const {
+    char *ptr_ = (char*) const_cast<void*>(memory_.ptr<void>());
+    return (ptr_
+            ? (TM*) (ptr_ + offset_)
+            : NULL);
+  }
 }
@@ -0,0 +1,96 @@
+#ifndef OCCA_CORE_MEMORYPOOL_HEADER
+#define OCCA_CORE_MEMORYPOOL_HEADER
+
+#include <map>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/hash.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  class modeDevice_t;
+  class modeMemory_t;
+  class modeStream_t;
+
+  //---[ memoryPool_t ]-----------------
+  // Keeps freed allocations around so the next malloc with the same
+  //   memory properties reuses them instead of going to the backend
+  //
+  //   - Allocations up to [max_bin_bytes] are rounded up to size classes
+  //     (4 per power of 2) and cached in bins
+  //   - Larger allocations are rounded up to [large_block_bytes] and
+  //     reused by best fit if the block isn't 25% larger than needed
+  //
+  // Free lists are kept per stream. A stream reuses its own freed blocks
+  //   right away since its queued work runs in order, blocks freed on
+  //   other streams are only reused after that stream finishes
+  //
+  // Device properties:
+  //   memory_pool: {
+  //     enabled: true,
+  //     max_bin_bytes: 1048576,
+  //     large_block_bytes: 1048576,
+  //     max_cached_bytes: 0,  // No limit
+  //   }
+  class memoryPool_t {
+  public:
+    typedef std::vector<modeMemory_t*> blockVector;
+    typedef std::multimap<udim_t, modeMemory_t*> largeBlockMap;
+
+    class freeList_t {
+    public:
+      std::vector<blockVector> bins;
+      largeBlockMap largeBlocks;
+    };
+
+    // Blocks are only shared between allocations on the same stream
+    //   and with the same memory properties
+    typedef std::pair<modeStream_t*, hash_t> freeListKey;
+    typedef std::map<freeListKey, freeList_t> freeListMap;
+
+    modeDevice_t *modeDevice;
+
+    udim_t maxBinBytes;
+    udim_t largeBlockBytes;
+    udim_t maxCachedBytes;
+
+    freeListMap freeLists;
+    udim_t bytesCached;
+    udim_t hits;
+    udim_t misses;
+
+    memoryPool_t(modeDevice_t *modeDevice_,
+                 const occa::properties &props);
+
+    virtual ~memoryPool_t();
+
+    virtual modeMemory_t* malloc(const udim_t bytes,
+                                 const void *src,
+                                 const occa::properties &props);
+
+    // Returns false if the memory isn't pooled and should be freed
+    virtual bool release(modeMemory_t *mem);
+
+    // Frees all cached blocks
+    virtual void trim();
+
+    // Blocks freed on [modeStream] no longer need to wait for it
+    void removeStream(modeStream_t *modeStream);
+
+    udim_t blockBytes(const udim_t bytes) const;
+
+  private:
+    modeMemory_t* takeBlock(freeList_t &freeList,
+                            const udim_t capacity);
+
+    void addBlock(freeList_t &freeList,
+                  modeMemory_t *mem);
+
+    void finishStream(modeStream_t *modeStream);
+  };
+  //====================================
+}
+
+#endif
@@ -17,6 +17,6 @@
 
 #define OCCA_MAX_ARGS 50
 
-#define OCCA_DEFAULT_MEM_BYTE_ALIGN 32
+#define OCCA_DEFAULT_MEM_BYTE_ALIGN 64
 
 #endif
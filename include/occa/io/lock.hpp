@@ -7,6 +7,13 @@ namespace occa {
   class hash_t;
 
   namespace io {
+    namespace lockBackend {
+      // mkdir() the lock and poll until it is removed
+      static const int dir   = 0;
+      // flock() a lock file, waiters wake up as soon as it's released
+      static const int flock = 1;
+    }
+
     class lock_t {
     private:
       mutable std::string lockDir;
@@ -15,6 +22,10 @@ namespace occa {
       float staleAge;
       mutable bool released;
 
+      int backend;
+      bool usingInotify;
+      mutable int fd;
+
     public:
       lock_t();
 
@@ -26,13 +37,25 @@ namespace occa {
 
       bool isInitialized() const;
 
+      // Path to the lock directory or lock file, depending on the backend
       const std::string& dir() const;
 
+      int getBackend() const;
+
       void release() const;
 
       bool isMine();
 
       bool isReleased();
+
+    private:
+      bool fileLockIsMine();
+
+      int waitForFileLock();
+
+      bool holdsLockFile() const;
+
+      void closeLockFile() const;
     };
   }
 }
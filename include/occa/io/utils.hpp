@@ -16,6 +16,8 @@ namespace occa {
     extern const std::string launcherSourceFile;
     extern const std::string launcherBinaryFile;
     extern const std::string launcherBuildFile;
+    extern const std::string jitBinaryFile;
+    extern const std::string preludeFile;
   }
 
   namespace io {
@@ -76,6 +78,11 @@ namespace occa {
 
     void write(const std::string &filename,
                const std::string &content);
+
+    // Readers never see a partially written file, even when
+    //   several processes write it at once
+    void atomicWrite(const std::string &filename,
+                     const std::string &content);
   }
 }
 
@@ -10,6 +10,7 @@
 #include <occa/lang/builtins/attributes/inner.hpp>
 #include <occa/lang/builtins/attributes/kernel.hpp>
 #include <occa/lang/builtins/attributes/outer.hpp>
+#include <occa/lang/builtins/attributes/reduce.hpp>
 #include <occa/lang/builtins/attributes/restrict.hpp>
 #include <occa/lang/builtins/attributes/shared.hpp>
 #include <occa/lang/builtins/attributes/tile.hpp>
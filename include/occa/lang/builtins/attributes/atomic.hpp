@@ -25,22 +25,29 @@ namespace occa {
 
         virtual bool isValid(const attributeToken_t &attr) const;
 
+        // isBasicExprSmnt picks which expressions the backend can make
+        //   atomic on their own through transformBasicExprSmnt
         static bool applyCodeTransformation(
           blockStatement &root,
           blockSmntBoolCallback transformBlockSmnt,
-          exprSmntBoolCallback transformBasicExprSmnt
+          exprSmntBoolCallback transformBasicExprSmnt,
+          exprSmntBoolCallback isBasicExprSmnt = isBasicExpression
         );
 
         static bool applyExpressionCodeTransformation(
           expressionStatement &exprSmnt,
           blockSmntBoolCallback transformBlockSmnt,
-          exprSmntBoolCallback transformBasicExprSmnt
+          exprSmntBoolCallback transformBasicExprSmnt,
+          exprSmntBoolCallback isBasicExprSmnt = isBasicExpression
         );
 
+        // Blocks made up of only basic expressions are transformed
+        //   one statement at a time
         static bool applyBlockCodeTransformation(
           blockStatement &blockSmnt,
           blockSmntBoolCallback transformBlockSmnt,
-          exprSmntBoolCallback transformBasicExprSmnt
+          exprSmntBoolCallback transformBasicExprSmnt,
+          exprSmntBoolCallback isBasicExprSmnt = isBasicExpression
         );
 
         static bool isBasicExpression(expressionStatement &exprSmnt);
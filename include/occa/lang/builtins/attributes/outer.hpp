@@ -15,6 +15,8 @@ namespace occa {
         virtual bool forStatementType(const int sType) const;
 
         virtual bool isValid(const attributeToken_t &attr) const;
+
+        bool validKwargs(const attributeToken_t &attr) const;
       };
     }
   }
@@ -0,0 +1,54 @@
+#ifndef OCCA_LANG_BUILTINS_ATTRIBUTES_REDUCE_HEADER
+#define OCCA_LANG_BUILTINS_ATTRIBUTES_REDUCE_HEADER
+
+#include <functional>
+
+#include <occa/lang/attribute.hpp>
+
+namespace occa {
+  namespace lang {
+    class blockStatement;
+    class exprNode;
+    class forStatement;
+
+    typedef std::function<bool (const std::string &op)> reduceOperatorCallback;
+
+    namespace attributes {
+      //---[ @reduce ]--------------------
+      // Reduces values into the variables across @outer iterations:
+      //   for (...; @outer @reduce("+", sum)) { ... sum[0] += x; ... }
+      // Pointer variables reduce into their first entry
+      class reduce : public attribute_t {
+      public:
+        reduce();
+
+        virtual const std::string& name() const;
+
+        virtual bool forStatementType(const int sType) const;
+
+        virtual bool isValid(const attributeToken_t &attr) const;
+
+        static bool isValidOperator(const std::string &op);
+
+        static std::string getOperator(const attributeToken_t &attr);
+
+        static void getVariables(const attributeToken_t &attr,
+                                 std::vector<variable_t*> &vars);
+
+        static bool supportsAllOperators(const std::string &op);
+
+        // Returns the variable assigned in [expr], NULL if it isn't an update
+        static variable_t* getUpdatedVariable(exprNode *expr);
+
+        // Backends without native reductions make each statement
+        //   updating a reduced variable @atomic
+        static bool applyAtomicTransformations(blockStatement &root,
+                                               const attribute_t &atomicAttribute,
+                                               reduceOperatorCallback isSupportedOperator = supportsAllOperators);
+      };
+      //==================================
+    }
+  }
+}
+
+#endif
@@ -27,6 +27,8 @@ namespace occa {
 
         virtual std::string getInnerIterator(const int loopIndex);
 
+        virtual bool supportsReduceOperator(const std::string &op);
+
         void updateConstToConstant();
 
         void setFunctionQualifiers();
@@ -42,6 +44,8 @@ namespace occa {
         static bool transformBlockStatement(blockStatement &blockSmnt);
 
         static bool transformBasicExpressionStatement(expressionStatement &exprSmnt);
+
+        static bool isBasicExpression(expressionStatement &exprSmnt);
       };
     }
   }
@@ -40,6 +40,8 @@ namespace occa {
 
       bool kernelHasValidLoopBreakAndContinue(functionDeclStatement &kernelSmnt);
 
+      bool kernelHasValidReductions(functionDeclStatement &kernelSmnt);
+
       //---[ Helper Methods ]-----------
       bool isOklForLoop(statement_t *smnt);
 
@@ -8,19 +8,46 @@ namespace occa {
     namespace okl {
       class openmpParser : public serialParser {
       public:
+        int atomicBlockCount;
+
         openmpParser(const occa::properties &settings_ = occa::properties());
 
+        virtual void onClear();
+
         virtual void afterParsing();
 
+        statementArray getOuterMostOuterLoops();
+
         void setupOmpPragmas();
 
+        // "omp parallel for" with schedule, collapse, proc_bind and
+        //   num_threads clauses from the omp/* props or @outer kwargs
+        std::string getOmpPragma(forStatement &forSmnt);
+
+        int getCollapse(forStatement &forSmnt,
+                        const std::string &collapseSetting);
+
+        void getCollapsedOuterLoops(forStatement &forSmnt,
+                                    const int collapse,
+                                    std::vector<forStatement*> &loops);
+
+        // Lowers @outer loops to occa::parallelFor, run by
+        //   the work-stealing pool in libocca
+        void setupThreadPoolLoops();
+
+        void setupThreadPoolLoop(forStatement &forSmnt);
+
         bool isOuterForLoop(statement_t *smnt);
 
         void setupAtomics();
 
-        static bool transformBlockStatement(blockStatement &blockSmnt);
+        // Uses a named critical section unique to the @atomic block
+        bool transformBlockStatement(blockStatement &blockSmnt);
 
         static bool transformBasicExpressionStatement(expressionStatement &exprSmnt);
+
+        // Updates supported by "omp atomic update"
+        static bool isBasicExpression(expressionStatement &exprSmnt);
       };
     }
   }
@@ -9,6 +9,7 @@ namespace occa {
       class serialParser : public parser_t {
       public:
         static const std::string exclusiveIndexName;
+        static const std::string trampolinePrefix;
 
         serialParser(const occa::properties &settings_ = occa::properties());
 
@@ -31,6 +32,16 @@ namespace occa {
         exprNode* addExclusiveVariableArrayAccessor(statement_t &smnt,
                                                     exprNode &expr,
                                                     variable_t &var);
+
+        // Adds "#pragma omp simd" before inner-most @inner loops
+        void setupSimdPragmas();
+
+        bool canVectorize(forStatement &forSmnt);
+
+        std::string getSimdPragma(forStatement &forSmnt);
+
+        // Adds an extern "C" launch trampoline for each kernel
+        void setupTrampolines();
       };
     }
   }
@@ -78,6 +78,9 @@ namespace occa {
 
         virtual bool usesBarriers();
 
+        // @reduce operators that can be lowered to atomic updates
+        virtual bool supportsReduceOperator(const std::string &op);
+
         virtual std::string getOuterIterator(const int loopIndex) = 0;
         virtual std::string getInnerIterator(const int loopIndex) = 0;
       };
@@ -10,6 +10,8 @@ namespace occa {
   namespace cuda {
     class device;
 
+    // Not cloned for in-memory cache hits (see modeKernel_t::clone),
+    //   each kernel unloads the CUmodule it loaded
     class kernel : public occa::launchedModeKernel_t {
       friend class device;
 
@@ -32,7 +32,7 @@ namespace occa {
 
       CUstream& getCuStream() const;
 
-      kernelArg makeKernelArg() const;
+      kernelArg makeKernelArg(const udim_t offset = 0) const;
 
       modeMemory_t* addOffset(const dim_t offset);
 
@@ -8,6 +8,8 @@ namespace occa {
   namespace hip {
     class device;
 
+    // Not cloned for in-memory cache hits (see modeKernel_t::clone),
+    //   each kernel unloads the hipModule_t it loaded
     class kernel : public occa::launchedModeKernel_t {
       friend class device;
 
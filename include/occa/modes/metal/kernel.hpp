@@ -8,6 +8,8 @@ namespace occa {
   namespace metal {
     class device;
 
+    // Not cloned for in-memory cache hits (see modeKernel_t::clone),
+    //   each kernel releases the function it created
     class kernel : public occa::launchedModeKernel_t {
       friend class device;
 
@@ -9,6 +9,8 @@ namespace occa {
   namespace opencl {
     class device;
 
+    // Not cloned for in-memory cache hits (see modeKernel_t::clone),
+    //   cl_kernel objects hold their arguments and can't be shared
     class kernel : public occa::launchedModeKernel_t {
       friend class device;
       friend cl_kernel getCLKernel(occa::kernel kernel);
@@ -1,6 +1,8 @@
 #ifndef OCCA_MODES_OPENCL_MEMORY_HEADER
 #define OCCA_MODES_OPENCL_MEMORY_HEADER
 
+#include <map>
+
 #include <occa/core/memory.hpp>
 #include <occa/modes/opencl/polyfill.hpp>
 
@@ -27,6 +29,11 @@ namespace occa {
       cl_mem clMem;
       void *mappedPtr;
 
+      // Sub-buffers for memoryView kernel arguments, keyed by (offset, bytes)
+      typedef std::pair<udim_t, udim_t> offsetClMemKey;
+      typedef std::map<offsetClMemKey, cl_mem> offsetClMemMap;
+      mutable offsetClMemMap offsetClMems;
+
     public:
       memory(modeDevice_t *modeDevice_,
              udim_t size_,
@@ -35,7 +42,9 @@ namespace occa {
 
       cl_command_queue& getCommandQueue() const;
 
-      kernelArg makeKernelArg() const;
+      kernelArg makeKernelArg(const udim_t offset = 0) const;
+
+      cl_mem& getOffsetClMem(const udim_t offset) const;
 
       modeMemory_t* addOffset(const dim_t offset);
 
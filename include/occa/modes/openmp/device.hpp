@@ -1,6 +1,8 @@
 #ifndef OCCA_MODES_OPENMP_DEVICE_HEADER
 #define OCCA_MODES_OPENMP_DEVICE_HEADER
 
+#include <mutex>
+
 #include <occa/modes/serial/device.hpp>
 
 namespace occa {
@@ -11,17 +13,30 @@ namespace occa {
       //   due to compiler changes
       std::string lastCompiler;
       std::string lastCompilerOpenMPFlag;
+      // Kernel builds can be set up in the compile pool
+      std::mutex lastCompilerMutex;
 
     public:
       device(const occa::properties &properties_);
 
       virtual hash_t kernelHash(const occa::properties &props) const;
 
+      // Compiling OpenMP with clang requires linking libomp
+      virtual bool supportsInProcessJit() const;
+
       virtual bool parseFile(const std::string &filename,
                              const std::string &outputFile,
                              const occa::properties &kernelProps,
                              lang::sourceMetadata_t &metadata);
 
+      bool setupKernelProps(const occa::properties &kernelProps,
+                            occa::properties &allKernelProps);
+
+      virtual modeKernelBuild_t* startKernelBuild(const std::string &filename,
+                                                  const std::string &kernelName,
+                                                  const hash_t kernelHash,
+                                                  const occa::properties &kernelProps);
+
       virtual modeKernel_t* buildKernel(const std::string &filename,
                                         const std::string &kernelName,
                                         const hash_t kernelHash,
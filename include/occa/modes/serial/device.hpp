@@ -6,8 +6,12 @@
 
 namespace occa {
   namespace serial {
+    class kernelBuild;
+    class stream;
+
     class device : public occa::modeDevice_t {
       mutable hash_t hash_;
+      int asyncStreams;
 
     public:
       device(const occa::properties &properties_);
@@ -28,6 +32,18 @@ namespace occa {
       virtual void waitFor(streamTag tag);
       virtual double timeBetween(const streamTag &startTag,
                                  const streamTag &endTag);
+
+      stream* getCurrentStream() const;
+
+      void addAsyncStream();
+      void removeAsyncStream();
+      bool hasAsyncStreams() const;
+
+      // Waits on all async streams, used before freeing
+      //   kernels or memory that queued work might be using
+      void finishAllStreams() const;
+
+      virtual modeGraph_t* createGraph(const occa::properties &props);
       //================================
 
       //---[ Kernel ]-------------------
@@ -36,6 +52,11 @@ namespace occa {
                              const occa::properties &kernelProps,
                              lang::sourceMetadata_t &metadata);
 
+      virtual modeKernelBuild_t* startKernelBuild(const std::string &filename,
+                                                  const std::string &kernelName,
+                                                  const hash_t kernelHash,
+                                                  const occa::properties &kernelProps);
+
       virtual modeKernel_t* buildKernel(const std::string &filename,
                                         const std::string &kernelName,
                                         const hash_t kernelHash,
@@ -51,6 +72,27 @@ namespace occa {
                                 const occa::properties &kernelProps,
                                 const bool isLauncerKernel);
 
+      // Returns the header with the standard kernel includes, precompiled
+      //   for the given compiler and flags
+      // [pchFlags] holds the flags needed to use the precompiled header
+      std::string getKernelPrelude(const occa::properties &kernelProps,
+                                   const std::string &compiler,
+                                   const std::string &compilerFlags,
+                                   const std::string &compilerEnvScript,
+                                   std::string &pchFlags);
+
+      // Whether kernels can be compiled and linked inside this process
+      //   when the jit/enabled kernel prop is set
+      virtual bool supportsInProcessJit() const;
+
+      // Prepares the compile command, compilation is left to kernelBuild::compile()
+      void setupKernelBuild(kernelBuild &build,
+                            const std::string &filename,
+                            const std::string &kernelName,
+                            const hash_t kernelHash,
+                            const occa::properties &kernelProps,
+                            const bool isLauncherKernel);
+
       virtual modeKernel_t* buildKernelFromBinary(const std::string &filename,
                                                   const std::string &kernelName,
                                                   const occa::properties &kernelProps);
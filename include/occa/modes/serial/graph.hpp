@@ -0,0 +1,60 @@
+#ifndef OCCA_MODES_SERIAL_GRAPH_HEADER
+#define OCCA_MODES_SERIAL_GRAPH_HEADER
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/core/graph.hpp>
+#include <occa/tools/threadPool.hpp>
+
+namespace occa {
+  namespace serial {
+    class kernel;
+
+    // Replays nodes directly on the host
+    //   Kernel argument pointers and copy addresses are resolved once
+    //   after capture, nodes without dependencies between them (work
+    //   captured on different streams) run concurrently
+    //
+    // Properties:
+    //   threads : Threads used for the replay, defaults to one per core
+    //
+    // run() returns after the replay has finished
+    class graph : public occa::modeGraph_t {
+    private:
+      // Resolved kernel for kernel nodes, NULL for copies
+      std::vector<kernel*> nodeKernels;
+      // Kernel argument pointers or the copy's [dest, src] pointers
+      std::vector<std::vector<void*> > nodePointers;
+
+      std::vector<std::vector<int> > dependents;
+      std::vector<int> roots;
+      std::vector<std::atomic<int> > pendingDependencies;
+
+      int threadCount;
+      threadPool *pool;
+
+      std::atomic<bool> failed;
+      std::mutex errorMutex;
+      std::exception_ptr error;
+
+    public:
+      graph(modeDevice_t *modeDevice_,
+            const occa::properties &properties_);
+      virtual ~graph();
+
+      virtual void finishCapture();
+
+      virtual void run();
+
+    private:
+      void runNode(const int index);
+      void runConcurrentNode(const int index);
+    };
+  }
+}
+
+#endif
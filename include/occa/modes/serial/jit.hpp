@@ -0,0 +1,35 @@
+#ifndef OCCA_MODES_SERIAL_JIT_HEADER
+#define OCCA_MODES_SERIAL_JIT_HEADER
+
+#include <occa/defines.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace serial {
+    // In-process kernel compilation through libclang + LLVM ORC
+    //   Only available when occa is built with OCCA_JIT_ENABLED
+    namespace jit {
+      bool isAvailable();
+
+      // Compiles the source file into an object file without forking a compiler
+      bool compile(const std::string &sourceFilename,
+                   const std::string &objectFilename,
+                   const std::string &compilerFlags,
+                   std::string &errors);
+
+      // Links the object file into a new JIT session
+      void* load(const std::string &objectFilename);
+
+      functionPtr_t lookup(void *handle,
+                           const std::string &functionName);
+
+      // Returns NULL instead of failing if the symbol doesn't exist
+      functionPtr_t tryLookup(void *handle,
+                              const std::string &functionName);
+
+      void free(void *handle);
+    }
+  }
+}
+
+#endif
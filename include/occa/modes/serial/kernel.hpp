@@ -1,21 +1,40 @@
 #ifndef OCCA_MODES_SERIAL_KERNEL_HEADER
 #define OCCA_MODES_SERIAL_KERNEL_HEADER
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include <occa/defines.hpp>
 #include <occa/core/kernel.hpp>
+#include <occa/modes/serial/trampoline.hpp>
 #include <occa/tools/sys.hpp>
 
 namespace occa {
   namespace serial {
     class device;
 
+    // A loaded kernel binary, closed when the last kernel using it
+    //   is freed
+    class kernelBinary {
+    public:
+      void *dlHandle;
+      void *jitHandle;
+
+      kernelBinary();
+      ~kernelBinary();
+    };
+
+    typedef std::shared_ptr<kernelBinary> kernelBinaryPtr;
+
     class kernel : public occa::modeKernel_t {
     protected:
-      void *dlHandle;
+      // Shared with kernels cloned from the kernel cache
+      kernelBinaryPtr binary;
       functionPtr_t function;
+      trampoline_t trampoline;
       mutable std::vector<void*> vArgs;
+      mutable std::atomic<int> queuedRuns;
 
     public:
       bool isLauncherKernel;
@@ -34,6 +53,17 @@ namespace occa {
 
       void run() const;
 
+      modeKernel_t* clone() const;
+
+      // Launches with argument pointers that were already set up
+      void launch(const int argc, void **args) const;
+
+    private:
+      void runWithArguments(const std::vector<kernelArgData> &launchArgs,
+                            std::vector<void*> &launchPtrs) const;
+
+    public:
+
       friend class device;
     };
   }
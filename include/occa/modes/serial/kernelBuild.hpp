@@ -0,0 +1,48 @@
+#ifndef OCCA_MODES_SERIAL_KERNELBUILD_HEADER
+#define OCCA_MODES_SERIAL_KERNELBUILD_HEADER
+
+#include <occa/defines.hpp>
+#include <occa/core/kernelBuild.hpp>
+#include <occa/io/lock.hpp>
+#include <occa/lang/kernelMetadata.hpp>
+
+namespace occa {
+  namespace serial {
+    class device;
+
+    class kernelBuild : public occa::modeKernelBuild_t {
+    public:
+      device *modeDevice;
+
+      std::string filename;
+      std::string kernelName;
+      std::string hashDir;
+      std::string kcBinaryFile;
+      std::string binaryFilename;
+      occa::properties kernelProps;
+      lang::sourceMetadata_t metadata;
+
+      io::lock_t lock;
+      bool isValid;
+      bool foundBinary;
+
+      std::string command;
+      int compileError;
+
+      // Compiles in-process, falling back to [command] if it fails
+      bool usingJit;
+      std::string sourceFilename;
+      std::string sharedBinaryFilename;
+      std::string jitCompilerFlags;
+
+      kernelBuild(device *modeDevice_);
+
+      virtual bool needsCompile() const;
+      virtual void compile();
+
+      virtual modeKernel_t* finish();
+    };
+  }
+}
+
+#endif
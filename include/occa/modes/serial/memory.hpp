@@ -8,12 +8,16 @@ namespace occa {
   namespace serial {
     class memory : public occa::modeMemory_t {
     public:
+      // Set with the [parallel_copies] memory property, splits large
+      //   copies across the host thread pool
+      bool parallelCopies;
+
       memory(modeDevice_t *modeDevice_,
              udim_t size_,
              const occa::properties &properties_ = occa::properties());
       ~memory();
 
-      kernelArg makeKernelArg() const;
+      kernelArg makeKernelArg(const udim_t offset = 0) const;
 
       modeMemory_t* addOffset(const dim_t offset);
 
@@ -33,6 +37,19 @@ namespace occa {
                     const udim_t srcOffset,
                     const occa::properties &props);
       void detach();
+
+    private:
+      // Copies in order with the current stream's queued work
+      //   and only blocks on it if the copy isn't async
+      void streamMemcpy(void *dest,
+                        const void *src,
+                        const udim_t bytes,
+                        const occa::properties &props) const;
+
+      static void hostCopy(void *dest,
+                           const void *src,
+                           const udim_t bytes,
+                           const bool parallel);
     };
   }
 }
@@ -3,15 +3,30 @@
 
 #include <occa/defines.hpp>
 #include <occa/core/stream.hpp>
+#include <occa/tools/threadPool.hpp>
 
 namespace occa {
   namespace serial {
     class stream : public occa::modeStream_t {
+    private:
+      // Worker thread running the stream's work in FIFO order
+      //   NULL for synchronous streams
+      threadPool *queue;
+
     public:
       stream(modeDevice_t *modeDevice_,
              const occa::properties &properties_);
 
       virtual ~stream();
+
+      bool isAsync() const;
+
+      // Runs the job on the stream's worker, or inline if
+      //   the stream is synchronous
+      void enqueue(const threadPool::job_t &job);
+
+      // Blocks until all enqueued work has finished
+      void finish();
     };
   }
 }
@@ -3,6 +3,9 @@
 #ifndef OCCA_MODES_SERIAL_STREAMTAG_HEADER
 #define OCCA_MODES_SERIAL_STREAMTAG_HEADER
 
+#include <condition_variable>
+#include <mutex>
+
 #include <occa/core/streamTag.hpp>
 
 namespace occa {
@@ -11,10 +14,24 @@ namespace occa {
     public:
       double time;
 
+    private:
+      std::mutex mutex;
+      std::condition_variable reachedCondition;
+      bool reached;
+
+    public:
       streamTag(modeDevice_t *modeDevice_,
                 double time_);
 
+      // Tags recorded on async streams are reached when the
+      //   stream's worker gets to them
+      streamTag(modeDevice_t *modeDevice_);
+
       virtual ~streamTag();
+
+      void record();
+      bool isReached();
+      void wait();
     };
   }
 }
@@ -0,0 +1,56 @@
+#ifndef OCCA_MODES_SERIAL_TRAMPOLINE_HEADER
+#define OCCA_MODES_SERIAL_TRAMPOLINE_HEADER
+
+// Included by generated serial kernel sources
+//   Each kernel gets an extern "C" trampoline which unpacks the argument
+//   pointers with the kernel's own signature, so launches don't go
+//   through the sys::runFunction switch on the argument count
+
+namespace occa {
+  namespace serial {
+    typedef void (*trampoline_t)(void **args);
+
+    template <class TM>
+    struct trampolineArg {
+      static inline TM get(void *arg) {
+        return (TM) arg;
+      }
+    };
+
+    // Non-pointer kernel arguments are passed by reference
+    template <class TM>
+    struct trampolineArg<TM&> {
+      static inline TM& get(void *arg) {
+        return *((TM*) arg);
+      }
+    };
+
+    template <int ...INDICES>
+    struct trampolineIndices {};
+
+    template <int N, int ...INDICES>
+    struct makeTrampolineIndices : makeTrampolineIndices<N - 1, N - 1, INDICES...> {};
+
+    template <int ...INDICES>
+    struct makeTrampolineIndices<0, INDICES...> {
+      typedef trampolineIndices<INDICES...> type;
+    };
+
+    template <class ...ARGS, int ...INDICES>
+    inline void callKernel(void (*kernel)(ARGS...),
+                           void **args,
+                           trampolineIndices<INDICES...>) {
+      kernel(trampolineArg<ARGS>::get(args[INDICES])...);
+    }
+
+    template <class ...ARGS>
+    inline void callKernel(void (*kernel)(ARGS...),
+                           void **args) {
+      callKernel(kernel,
+                 args,
+                 typename makeTrampolineIndices<sizeof...(ARGS)>::type());
+    }
+  }
+}
+
+#endif
@@ -7,6 +7,8 @@
 #include <mpi.h>
 #include <vector>
 
+#include <occa/core/device.hpp>
+#include <occa/core/kernel.hpp>
 #include <occa/tools/json.hpp>
 
 namespace occa {
@@ -28,6 +30,39 @@ namespace occa {
 
     void barrier();
 
+    //---[ Nodes ]----------------------
+    // Ranks are grouped by the node (shared memory) they run on,
+    //   settings()["mpi/ranks_per_node"] overrides the grouping
+    MPI_Comm nodeComm();
+    // Communicator between the first rank of each node
+    //   (MPI_COMM_NULL on the other ranks)
+    MPI_Comm nodeLeaderComm();
+
+    int nodeId();
+    int nodeSize();
+    bool isNodeLeader();
+    //==================================
+
+    //---[ Kernel Builds ]--------------
+    // Collective over MPI_COMM_WORLD
+    // Instead of every rank racing on the kernel cache, one rank builds
+    //   the kernel and the rest load the cached binary once it's ready.
+    // settings()["mpi/kernel_cache"] picks how binaries reach each node:
+    //   "shared"   : OCCA_CACHE_DIR is shared, rank 0 builds
+    //   "broadcast": OCCA_CACHE_DIR is node-local, rank 0 builds and
+    //                sends the cached files to each node
+    //   "node"     : OCCA_CACHE_DIR is node-local, one rank per node builds
+    occa::kernel buildKernel(occa::device device,
+                             const std::string &filename,
+                             const std::string &kernelName,
+                             const occa::properties &props = occa::properties());
+
+    occa::kernel buildKernelFromString(occa::device device,
+                                       const std::string &content,
+                                       const std::string &kernelName,
+                                       const occa::properties &props = occa::properties());
+    //==================================
+
     //---[ Types ]----------------------
     template <class TM>
     MPI_Datatype type() {
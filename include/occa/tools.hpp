@@ -6,6 +6,7 @@
 #include <occa/tools/exception.hpp>
 #include <occa/tools/gc.hpp>
 #include <occa/tools/hash.hpp>
+#include <occa/tools/hostCopy.hpp>
 #include <occa/tools/json.hpp>
 #include <occa/tools/lex.hpp>
 #include <occa/tools/misc.hpp>
@@ -13,8 +14,10 @@
 #include <occa/tools/string.hpp>
 #include <occa/tools/styling.hpp>
 #include <occa/tools/sys.hpp>
+#include <occa/tools/threadPool.hpp>
 #include <occa/tools/tls.hpp>
 #include <occa/tools/uva.hpp>
 #include <occa/tools/vector.hpp>
+#include <occa/tools/workStealingPool.hpp>
 
 #endif
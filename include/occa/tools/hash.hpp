@@ -2,13 +2,18 @@
 #define OCCA_TOOLS_HASH_HEADER
 
 #include <iostream>
+#include <stdint.h>
 
 #include <occa/defines.hpp>
 #include <occa/io/output.hpp>
 #include <occa/types.hpp>
 
+// Bumped whenever hash values change so cached files from an older
+//   hash are never picked up
+#define OCCA_HASH_VERSION 3
+
 namespace occa {
-  // Uses FNV hashing
+  // 256-bit hash, see hasher_t
   class hash_t {
   public:
     bool initialized;
@@ -47,6 +52,32 @@ namespace occa {
   std::ostream& operator << (std::ostream &out,
                            const hash_t &hash);
 
+  // Incremental hashing where updating with the input in pieces gives
+  //   the same hash as occa::hash() on the whole input
+  // Input is read in 64-byte stripes over 8 independent 64-bit lanes
+  //   (xxHash3-style) so the accumulate step maps onto SIMD registers
+  class hasher_t {
+  private:
+    uint64_t acc[8];
+    unsigned char buffer[64];
+    int bufferBytes;
+    int stripe;
+    udim_t totalBytes;
+
+  public:
+    hasher_t();
+
+    void clear();
+
+    hasher_t& update(const void *ptr, const udim_t bytes);
+    hasher_t& update(const std::string &str);
+
+    hash_t digest() const;
+
+  private:
+    void processStripe(const unsigned char *ptr);
+  };
+
   hash_t hash(const void *ptr, udim_t bytes);
 
   template <class TM>
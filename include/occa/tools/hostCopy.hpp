@@ -0,0 +1,38 @@
+#ifndef OCCA_TOOLS_HOSTCOPY_HEADER
+#define OCCA_TOOLS_HOSTCOPY_HEADER
+
+#include <occa/defines.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  //---[ Host Copies ]------------------
+  // Copies and fills of host memory, large ones are split across the
+  //   host thread pool
+  //
+  // Buffers are split into one contiguous share per thread, the same way
+  //   for copies, fills and hostFirstTouch(). Pages placed by a thread's
+  //   first touch are later copied by that same thread, keeping the
+  //   traffic on its NUMA node
+  namespace hostCopy {
+    // Smaller copies use ::memcpy and ::memset on the calling thread
+    static const udim_t parallelBytes = (1 << 22);
+    // Larger copies bypass the cache with non-temporal stores
+    static const udim_t nonTemporalBytes = (1 << 25);
+  }
+
+  void hostMemcpy(void *dest,
+                  const void *src,
+                  const udim_t bytes);
+
+  void hostMemset(void *dest,
+                  const int value,
+                  const udim_t bytes);
+
+  // Writes to each page of [ptr] from the thread which will copy it
+  //   so the OS places the page on that thread's NUMA node
+  void hostFirstTouch(void *ptr,
+                      const udim_t bytes);
+  //====================================
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef OCCA_TOOLS_JSON_HEADER
 #define OCCA_TOOLS_JSON_HEADER
 
+#include <atomic>
 #include <vector>
 #include <map>
 
@@ -15,12 +16,49 @@ namespace occa {
   typedef std::map<std::string, json> jsonObject;
   typedef std::vector<json>           jsonArray;
 
-  typedef struct {
+  namespace jsonHashState {
+    static const int none      = 0;
+    static const int computing = 1;
+    static const int ready     = 2;
+  }
+
+  // Strings, numbers, arrays and objects are reference counted and
+  //   shared between copies until one of them is modified
+  template <class TM>
+  class jsonShared_t {
+  public:
+    std::atomic<int> refs;
+    TM value;
+
+    // Set once a mutable reference to the value is handed out
+    //   The value can then change without going through json, so
+    //   copies get their own value and the hash isn't cached
+    bool hasMutableRefs;
+
+    // json::hash() of the value, reset when the value is modified
+    std::atomic<int> hashState;
+    hash_t hash;
+
+    inline jsonShared_t() :
+      refs(1),
+      hasMutableRefs(false),
+      hashState(jsonHashState::none) {}
+
+    inline jsonShared_t(const TM &value_) :
+      refs(1),
+      value(value_),
+      hasMutableRefs(false),
+      hashState(jsonHashState::none) {}
+  };
+
+  // Only the member matching json::type is set
+  //   string, array and object values are NULL when empty
+  typedef union {
     bool boolean;
-    primitive number;
-    std::string string;
-    jsonArray array;
-    jsonObject object;
+    jsonShared_t<primitive> *number;
+    jsonShared_t<std::string> *string;
+    jsonShared_t<jsonArray> *array;
+    jsonShared_t<jsonObject> *object;
   } jsonValue_t;
 
   class json {
@@ -37,17 +75,24 @@ namespace occa {
       object_  = (1 << 6)
     };
 
+    // Note: Use the as*() methods or assignments to change the type
+    //       since they keep the shared value in sync
     type_t type;
     jsonValue_t value_;
 
-    inline json(type_t type_ = none_) {
-      clear();
-      type = type_;
+    inline json(type_t type_ = none_) :
+      type(none_) {
+      value_.object = NULL;
+      if (type_ != none_) {
+        resetValue(type_);
+      }
     }
 
     inline json(const json &j) :
       type(j.type),
-      value_(j.value_) {}
+      value_(j.value_) {
+      retainValue(type, value_);
+    }
 
     inline json(const bool value) :
       type(boolean_) {
@@ -56,77 +101,77 @@ namespace occa {
 
     inline json(const uint8_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const int8_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const uint16_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const int16_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const uint32_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const int32_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const uint64_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const int64_t value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const float value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const double value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const primitive &value) :
       type(number_) {
-      value_.number = value;
+      value_.number = new jsonShared_t<primitive>(value);
     }
 
     inline json(const char *value) :
       type(string_) {
-      value_.string = value;
+      value_.string = new jsonShared_t<std::string>(value);
     }
 
     inline json(const std::string &value) :
       type(string_) {
-      value_.string = value;
+      value_.string = new jsonShared_t<std::string>(value);
     }
 
     inline json(const jsonObject &value) :
       type(object_) {
-      value_.object = value;
+      value_.object = new jsonShared_t<jsonObject>(value);
     }
 
     inline json(const jsonArray &value) :
       type(array_) {
-      value_.array = value;
+      value_.array = new jsonShared_t<jsonArray>(value);
     }
 
     virtual ~json();
@@ -136,101 +181,186 @@ namespace occa {
     json& operator = (const json &j);
 
     inline json& operator = (const char *c) {
-      type = string_;
-      value_.string = c;
+      uniqueString() = c;
       return *this;
     }
 
     inline json& operator = (const std::string &value) {
-      type = string_;
-      value_.string = value;
+      uniqueString() = value;
       return *this;
     }
 
     inline json& operator = (const bool value) {
-      type = boolean_;
+      asBoolean();
       value_.boolean = value;
       return *this;
     }
 
     inline json& operator = (const uint8_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const int8_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const uint16_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const int16_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const uint32_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const int32_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const uint64_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const int64_t value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const float value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const double value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const primitive &value) {
-      type = number_;
-      value_.number = value;
+      uniqueNumber() = value;
       return *this;
     }
 
     inline json& operator = (const jsonObject &value) {
-      type = object_;
-      value_.object = value;
-      return *this;
+      return (*this = json(value));
     }
 
     inline json& operator = (const jsonArray &value) {
-      type = array_;
-      value_.array = value;
-      return *this;
+      return (*this = json(value));
+    }
+
+  private:
+    //---[ Shared Values ]--------------
+    template <class TM>
+    static inline const TM& sharedValue(const jsonShared_t<TM> *shared) {
+      static const TM empty;
+      return shared ? shared->value : empty;
+    }
+
+    // Copies the value if it's still shared with another json
+    //   and resets the cached hash since the value can be modified
+    template <class TM>
+    static inline TM& uniqueValue(jsonShared_t<TM> *&shared) {
+      if (!shared) {
+        shared = new jsonShared_t<TM>();
+      } else if (shared->refs > 1) {
+        jsonShared_t<TM> *copy = new jsonShared_t<TM>(shared->value);
+        releaseShared(shared);
+        shared = copy;
+      } else {
+        shared->hashState.store(jsonHashState::none,
+                                std::memory_order_relaxed);
+      }
+      return shared->value;
+    }
+
+    template <class TM>
+    static inline TM& mutableValue(jsonShared_t<TM> *&shared) {
+      TM &value = uniqueValue(shared);
+      shared->hasMutableRefs = true;
+      return value;
+    }
+
+    // Used by json methods that modify the value without handing out
+    //   references, unlike the public non-const accessors
+    inline primitive& uniqueNumber() {
+      asNumber();
+      return uniqueValue(value_.number);
+    }
+
+    inline std::string& uniqueString() {
+      asString();
+      return uniqueValue(value_.string);
+    }
+
+    inline jsonArray& uniqueArray() {
+      asArray();
+      return uniqueValue(value_.array);
     }
 
+    inline jsonObject& uniqueObject() {
+      asObject();
+      return uniqueValue(value_.object);
+    }
+
+    template <class TM>
+    hash_t cachedHash(jsonShared_t<TM> *shared) const;
+
+    hash_t computeHash() const;
+
+    template <class TM>
+    static inline void releaseShared(jsonShared_t<TM> *shared) {
+      if (shared && (--(shared->refs) == 0)) {
+        delete shared;
+      }
+    }
+
+    // Values with mutable references are copied instead of shared
+    //   so changes through the references don't reach the copy
+    template <class TM>
+    static inline void retainShared(jsonShared_t<TM> *&shared) {
+      if (!shared) {
+        return;
+      }
+      if (shared->hasMutableRefs) {
+        shared = new jsonShared_t<TM>(shared->value);
+      } else {
+        ++(shared->refs);
+      }
+    }
+
+    static inline void retainValue(const type_t type_,
+                                   jsonValue_t &value) {
+      switch (type_) {
+      case number_: retainShared(value.number); break;
+      case string_: retainShared(value.string); break;
+      case array_:  retainShared(value.array);  break;
+      case object_: retainShared(value.object); break;
+      default: break;
+      }
+    }
+
+    void releaseValue();
+
+    // Replaces the value with an empty value of the given type
+    void resetValue(const type_t type_);
+
+    // Returns the value at the '/'-separated path or NULL if it doesn't exist
+    const json* lookup(const char *c,
+                       const char escapeChar) const;
+    //==================================
+
+  public:
     virtual bool isInitialized() const;
 
     json& load(const char *&c);
@@ -262,6 +392,7 @@ namespace occa {
     json& operator += (const json &j);
 
     void mergeWithObject(const jsonObject &obj);
+    void mergeWithObject(const json &j);
 
     bool has(const std::string &s) const;
 
@@ -290,91 +421,103 @@ namespace occa {
     }
 
     inline json& asNull() {
-      if (type & ~(none_ | null_)) {
-        clear();
+      if (type != null_) {
+        resetValue(null_);
       }
-      type = null_;
       return *this;
     }
 
     inline json& asBoolean() {
-      if (type & ~(none_ | boolean_)) {
-        clear();
+      if (type != boolean_) {
+        resetValue(boolean_);
       }
-      type = boolean_;
       return *this;
     }
 
     inline json& asNumber() {
-      if (type & ~(none_ | number_)) {
-        clear();
+      if (type != number_) {
+        resetValue(number_);
       }
-      type = number_;
       return *this;
     }
 
     inline json& asString() {
-      if (type & ~(none_ | string_)) {
-        clear();
+      if (type != string_) {
+        resetValue(string_);
       }
-      type = string_;
       return *this;
     }
 
     inline json& asArray() {
-      if (type & ~(none_ | array_)) {
-        clear();
+      if (type != array_) {
+        resetValue(array_);
       }
-      type = array_;
       return *this;
     }
 
     inline json& asObject() {
-      if (type & ~(none_ | object_)) {
-        clear();
+      if (type != object_) {
+        resetValue(object_);
       }
-      type = object_;
       return *this;
     }
 
+    // Non-const accessors change the value to the accessor type
+    //   and make sure the value isn't shared with other copies
+    //
+    // Note: Copies made while references are held don't share the
+    //       value, so modifying it through them only changes this json
     inline bool& boolean() {
+      asBoolean();
       return value_.boolean;
     }
 
     inline primitive& number() {
-      return value_.number;
+      asNumber();
+      return mutableValue(value_.number);
     }
 
     inline std::string& string() {
-      return value_.string;
+      asString();
+      return mutableValue(value_.string);
     }
 
     inline jsonArray& array() {
-      return value_.array;
+      asArray();
+      return mutableValue(value_.array);
     }
 
     inline jsonObject& object() {
-      return value_.object;
+      asObject();
+      return mutableValue(value_.object);
     }
 
     inline bool boolean() const {
-      return value_.boolean;
+      return (type == boolean_) && value_.boolean;
     }
 
     inline const primitive& number() const {
-      return value_.number;
+      return sharedValue((type == number_)
+                         ? value_.number
+                         : NULL);
     }
 
     inline const std::string& string() const {
-      return value_.string;
+      return sharedValue((type == string_)
+                         ? value_.string
+                         : NULL);
     }
 
     inline const jsonArray& array() const {
-      return value_.array;
+      return sharedValue((type == array_)
+                         ? value_.array
+                         : NULL);
     }
 
     inline const jsonObject& object() const {
-      return value_.object;
+      return sharedValue((type == object_)
+                         ? value_.object
+                         : NULL);
     }
 
     json& operator [] (const char *c);
@@ -434,6 +577,11 @@ namespace occa {
       if (type != j.type) {
         return false;
       }
+      // Copies share the same value
+      if ((type & (number_ | string_ | array_ | object_))
+          && (value_.object == j.value_.object)) {
+        return true;
+      }
       switch (type) {
       case none_:
         return true;
@@ -442,13 +590,13 @@ namespace occa {
       case boolean_:
         return value_.boolean == j.value_.boolean;
       case number_:
-        return primitive::equal(value_.number, j.value_.number);
+        return primitive::equal(number(), j.number());
       case string_:
-        return value_.string == j.value_.string;
+        return string() == j.string();
       case object_:
-        return value_.object == j.value_.object;
+        return object() == j.object();
       case array_:
-        return value_.array == j.value_.array;
+        return array() == j.array();
       default:
         return false;
       }
@@ -459,9 +607,9 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return value_.number;
+        return number();
       case string_:
-        return value_.string.size();
+        return string().size();
       case object_:
         return true;
       case array_:
@@ -476,7 +624,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (uint8_t) value_.number;
+        return (uint8_t) number();
       default:
         return 0;
       }
@@ -487,7 +635,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (uint16_t) value_.number;
+        return (uint16_t) number();
       default:
         return 0;
       }
@@ -498,7 +646,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (uint32_t) value_.number;
+        return (uint32_t) number();
       default:
         return 0;
       }
@@ -509,7 +657,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (uint64_t) value_.number;
+        return (uint64_t) number();
       default:
         return 0;
       }
@@ -520,7 +668,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (int8_t) value_.number;
+        return (int8_t) number();
       default:
         return 0;
       }
@@ -531,7 +679,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (int16_t) value_.number;
+        return (int16_t) number();
       default:
         return 0;
       }
@@ -542,7 +690,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (int32_t) value_.number;
+        return (int32_t) number();
       default:
         return 0;
       }
@@ -553,7 +701,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (int64_t) value_.number;
+        return (int64_t) number();
       default:
         return 0;
       }
@@ -564,7 +712,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (float) value_.number;
+        return (float) number();
       default:
         return 0;
       }
@@ -575,7 +723,7 @@ namespace occa {
       case boolean_:
         return value_.boolean;
       case number_:
-        return (double) value_.number;
+        return (double) number();
       default:
         return 0;
       }
@@ -585,6 +733,11 @@ namespace occa {
       return toString();
     }
 
+    // Hashes the structure of the value, computed hashes are kept
+    //   with shared values so unchanged values and copies of them
+    //   are only hashed once
+    // Values with references from non-const accessors are rehashed
+    //   every time since they could have changed through them
     hash_t hash() const;
 
     std::string toString() const;
@@ -2,8 +2,7 @@ namespace occa {
   template <class TM>
   json& json::set(const char *key,
                   const TM &value) {
-    type = object_;
-    value_.object[key] = value;
+    uniqueObject()[key] = value;
     return *this;
   }
 
@@ -16,25 +15,9 @@ namespace occa {
   template <class TM>
   TM json::get(const char *key,
                const TM &default_) const {
-    const json *j = this;
-    const char *c = key;
-    while (*c != '\0') {
-      if (j->type != object_) {
-        return default_;
-      }
-
-      const char *cStart = c;
-      lex::skipTo(c, '/');
-      std::string nextKey(cStart, c - cStart);
-      if (*c == '/') {
-        ++c;
-      }
-
-      jsonObject::const_iterator it = j->value_.object.find(nextKey);
-      if (it == j->value_.object.end()) {
-        return default_;
-      }
-      j = &(it->second);
+    const json *j = lookup(key, '\0');
+    if (!j) {
+      return default_;
     }
     return *j;
   }
@@ -54,33 +37,17 @@ namespace occa {
   template <class TM>
   std::vector<TM> json::getArray(const char *c,
                                  const std::vector<TM> &default_) const {
-    const json *j = this;
-    while (*c) {
-      if (j->type != object_) {
-        return default_;
-      }
-
-      const char *cStart = c;
-      lex::skipTo(c, '/');
-      std::string key(cStart, c - cStart);
-      if (*c == '/') {
-        ++c;
-      }
-
-      jsonObject::const_iterator it = j->value_.object.find(key);
-      if (it == j->value_.object.end()) {
-        return default_;
-      }
-      j = &(it->second);
-    }
-    if (j->type != array_) {
+    const json *j = lookup(c, '\0');
+    if (!j || (j->type != array_)) {
       return default_;
     }
 
-    const int entries = (int) j->value_.array.size();
+    const jsonArray &arr = j->array();
+    const int entries = (int) arr.size();
     std::vector<TM> ret;
+    ret.reserve(entries);
     for (int i = 0; i < entries; ++i) {
-      ret.push_back((TM) j->value_.array[i]);
+      ret.push_back((TM) arr[i]);
     }
     return ret;
   }
@@ -29,23 +29,23 @@ namespace occa {
 
   inline properties operator + (const properties &left, const properties &right) {
     properties sum = left;
-    sum.mergeWithObject(right.value_.object);
+    sum.mergeWithObject(right);
     return sum;
   }
 
   inline properties operator + (const properties &left, const json &right) {
     properties sum = left;
-    sum.mergeWithObject(right.value_.object);
+    sum.mergeWithObject(right);
     return sum;
   }
 
   inline properties& operator += (properties &left, const properties &right) {
-    left.mergeWithObject(right.value_.object);
+    left.mergeWithObject(right);
     return left;
   }
 
   inline properties& operator += (properties &left, const json &right) {
-    left.mergeWithObject(right.value_.object);
+    left.mergeWithObject(right);
     return left;
   }
 
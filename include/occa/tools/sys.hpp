@@ -96,6 +96,9 @@ namespace occa {
     std::string compilerSharedBinaryFlags(const std::string &compiler);
     std::string compilerSharedBinaryFlags(const int vendor_);
 
+    std::string compilerOpenMPSimdFlags(const std::string &compiler);
+    std::string compilerOpenMPSimdFlags(const int vendor_);
+
     void addCompilerIncludeFlags(std::string &compilerFlags);
     void addCompilerLibraryFlags(std::string &compilerFlags);
 
@@ -105,6 +108,7 @@ namespace occa {
 
     //---[ Dynamic Methods ]------------
     void* malloc(udim_t bytes);
+    void* malloc(udim_t bytes, const udim_t alignment);
     void free(void *ptr);
 
     void* dlopen(const std::string &filename,
@@ -114,6 +118,10 @@ namespace occa {
                         const std::string &functionName,
                         const io::lock_t &lock = io::lock_t());
 
+    // Returns NULL instead of failing if the symbol doesn't exist
+    functionPtr_t tryDlsym(void *dlHandle,
+                           const std::string &functionName);
+
     void dlclose(void *dlHandle);
 
     void runFunction(functionPtr_t f, const int argc, void **args);
@@ -0,0 +1,51 @@
+#ifndef OCCA_TOOLS_THREADPOOL_HEADER
+#define OCCA_TOOLS_THREADPOOL_HEADER
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace occa {
+  //---[ threadPool ]-------------------
+  // Fixed set of worker threads consuming jobs in FIFO order
+  //   Jobs must not throw, errors should be stored and re-raised
+  //   by the thread that owns the result
+  class threadPool {
+  public:
+    typedef std::function<void ()> job_t;
+
+  private:
+    std::vector<std::thread> workers;
+    std::deque<job_t> jobs;
+
+    std::mutex jobMutex;
+    std::condition_variable jobAdded;
+    std::condition_variable jobsFinished;
+
+    int runningJobs;
+    bool stopping;
+
+  public:
+    threadPool(const int threadCount = 0);
+    ~threadPool();
+
+    int size() const;
+    int pendingJobs();
+
+    void push(const job_t &job);
+
+    // Blocks until all queued jobs have finished
+    void wait();
+
+    static int defaultThreadCount();
+
+  private:
+    void workerLoop();
+  };
+  //====================================
+}
+
+#endif
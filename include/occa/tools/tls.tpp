@@ -56,7 +56,13 @@ namespace occa {
   template <class TM>
   TM& tls<TM>::value() {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    return *((TM*) pthread_getspecific(pkey));
+    // Threads other than the one that created the tls start with TM()
+    TM *ptr = (TM*) pthread_getspecific(pkey);
+    if (!ptr) {
+      ptr = new TM();
+      pthread_setspecific(pkey, ptr);
+    }
+    return *ptr;
 #else
     return value_;
 #endif
@@ -64,11 +70,7 @@ namespace occa {
 
   template <class TM>
   const TM& tls<TM>::value() const {
-#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    return *((TM*) pthread_getspecific(pkey));
-#else
-    return value_;
-#endif
+    return const_cast<tls<TM>*>(this)->value();
   }
 
   template <class TM>
@@ -1,11 +1,14 @@
 #ifndef OCCA_UVA_HEADER
 #define OCCA_UVA_HEADER
 
+#include <atomic>
 #include <iostream>
+#include <map>
 #include <vector>
 
 #include <occa/defines.hpp>
 #include <occa/io/output.hpp>
+#include <occa/tools/sys.hpp>
 #include <occa/types.hpp>
 
 namespace occa {
@@ -13,12 +16,11 @@ namespace occa {
   class memory;
   class modeMemory_t;
   class ptrRange;
+  class ptrRangeIndex;
 
   typedef std::map<ptrRange, occa::modeMemory_t*> ptrRangeMap;
-  typedef std::vector<occa::modeMemory_t*>        memoryVector;
 
-  extern ptrRangeMap uvaMap;
-  extern memoryVector uvaStaleMemory;
+  extern ptrRangeIndex uvaMap;
 
   //---[ ptrRange ]---------------------
   class ptrRange {
@@ -42,6 +44,108 @@ namespace occa {
   //====================================
 
 
+  //---[ ptrRangeIndex ]----------------
+  // Thread-safe map from pointers to the memory whose range holds them
+  //
+  // The address space is split into 64KB chunks which are spread across
+  //   shards, a range is added to the shard of every chunk it covers.
+  //   Lookups only lock one shard for reading, so concurrent lookups
+  //   don't block each other
+  class ptrRangeIndex {
+  public:
+    static const int shardCount = 64;
+    static const int chunkShift = 16;
+
+    class shard_t {
+    public:
+      // > 0: Reader count, -1: Locked by a writer
+      std::atomic<int> lockState;
+      ptrRangeMap ranges;
+
+      shard_t();
+
+      void readLock();
+      void readUnlock();
+      void writeLock();
+      void writeUnlock();
+    };
+
+  private:
+    shard_t shards[shardCount];
+
+  public:
+    void insert(const ptrRange &range,
+                modeMemory_t *mem);
+
+    // Removes the range holding [ptr]
+    void erase(void *ptr);
+
+    modeMemory_t* find(const void *ptr);
+
+  private:
+    shard_t& getShard(const char *ptr);
+
+    void eraseRange(const ptrRange &range);
+  };
+  //====================================
+
+
+  //---[ dirtyRangeSet ]---------------
+  // Sorted byte ranges of a UVA allocation which changed on one side,
+  //   overlapping and adjacent ranges are coalesced when added
+  class dirtyRangeSet {
+  public:
+    // [start, end)
+    typedef std::pair<udim_t, udim_t> range_t;
+    typedef std::vector<range_t> rangeVector;
+
+  private:
+    // start -> end
+    std::map<udim_t, udim_t> ranges;
+
+  public:
+    bool isEmpty() const;
+    int rangeCount() const;
+    udim_t bytes() const;
+
+    void add(const udim_t offset,
+             const udim_t bytes_);
+
+    // Removes the ranges overlapping [offset, offset + bytes_),
+    //   clipping them to it and appending them to [taken]
+    void take(const udim_t offset,
+              const udim_t bytes_,
+              rangeVector &taken);
+
+    void clear();
+  };
+  //====================================
+
+
+  //---[ staleMemoryList ]--------------
+  // Intrusive list of UVA memory written by kernels which needs to be
+  //   copied back to the host, using modeMemory_t::{prevStale, nextStale}
+  class staleMemoryList {
+  private:
+    mutable mutex listMutex;
+    modeMemory_t *head;
+
+  public:
+    staleMemoryList();
+    ~staleMemoryList();
+
+    bool isEmpty() const;
+    bool contains(const modeMemory_t *mem) const;
+
+    void push(modeMemory_t *mem);
+    void remove(modeMemory_t *mem);
+
+    // Returns NULL if the list is empty
+    modeMemory_t* pop();
+  };
+  //====================================
+
+
   //---[ UVA ]--------------------------
   occa::modeMemory_t* uvaToMemory(void *ptr);
 
@@ -67,6 +171,10 @@ namespace occa {
   void removeFromStaleMap(void *ptr);
   void removeFromStaleMap(modeMemory_t *mem);
 
+  // Host writes through [ptr] for memory allocated with
+  //   [track_dirty_ranges: true], only dirty ranges are copied to the device
+  void markDirty(void *ptr, const udim_t bytes);
+
   void freeUvaPtr(void *ptr);
   //====================================
 }
@@ -0,0 +1,84 @@
+#ifndef OCCA_TOOLS_WORKSTEALINGPOOL_HEADER
+#define OCCA_TOOLS_WORKSTEALINGPOOL_HEADER
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <occa/types/typedefs.hpp>
+
+namespace occa {
+  typedef void (*parallelForChunk_t)(void *body,
+                                     const dim_t begin,
+                                     const dim_t end);
+
+  //---[ workStealingPool ]-------------
+  // Persistent threads splitting a range of iterations
+  //   Each thread starts with an even share of the iterations and
+  //   steals half of another thread's remaining iterations once
+  //   its own share runs out
+  class workStealingPool {
+  private:
+    struct workRange_t {
+      std::mutex mutex;
+      dim_t begin, end;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<workRange_t*> ranges;
+
+    // Only one parallelFor runs at a time
+    std::mutex dispatchMutex;
+
+    std::mutex stateMutex;
+    std::condition_variable workAdded;
+    std::condition_variable workFinished;
+    udim_t generation;
+    int busyWorkers;
+    bool stopping;
+
+    parallelForChunk_t runChunk;
+    void *body;
+    dim_t chunkSize;
+
+  public:
+    workStealingPool(const int threadCount = 0);
+    ~workStealingPool();
+
+    // Includes the calling thread
+    int size() const;
+
+    // Runs runChunk(body, begin, end) over [0, iterations)
+    //   chunkSize <= 0 picks a chunk size from the iteration count
+    void parallelFor(const dim_t iterations,
+                     const dim_t chunkSize_,
+                     parallelForChunk_t runChunk_,
+                     void *body_);
+
+    static int defaultThreadCount();
+
+  private:
+    void workerLoop(const int id);
+    void runRanges(const int id);
+    bool stealRange(const int id);
+  };
+  //====================================
+
+  // Pool shared by host kernels, created on first use
+  workStealingPool& getHostThreadPool();
+
+  void parallelFor(const dim_t iterations,
+                   const dim_t chunkSize,
+                   parallelForChunk_t runChunk,
+                   void *body);
+
+  template <class bodyType>
+  void parallelForChunk(void *body,
+                        const dim_t begin,
+                        const dim_t end);
+}
+
+#include "workStealingPool.tpp"
+
+#endif
@@ -0,0 +1,11 @@
+namespace occa {
+  template <class bodyType>
+  void parallelForChunk(void *body,
+                        const dim_t begin,
+                        const dim_t end) {
+    bodyType &func = *((bodyType*) body);
+    for (dim_t i = begin; i < end; ++i) {
+      func(i);
+    }
+  }
+}
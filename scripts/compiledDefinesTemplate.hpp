@@ -27,6 +27,7 @@
 #define OCCA_HIP_ENABLED    @@OCCA_HIP_ENABLED@@
 #define OCCA_OPENCL_ENABLED @@OCCA_OPENCL_ENABLED@@
 #define OCCA_METAL_ENABLED  @@OCCA_METAL_ENABLED@@
+#define OCCA_JIT_ENABLED    @@OCCA_JIT_ENABLED@@
 
 #define OCCA_BUILD_DIR     "@@OCCA_BUILD_DIR@@"
 
@@ -50,10 +50,10 @@ def operator_args(N, indent, argtype, argname=None):
     return content
 
 
-def array_args(N, indent):
+def array_args(N, indent, prefix=''):
     content = ''
     for n in range(1, N + 1):
-        content += 'arg{n}'.format(n=n)
+        content += '{prefix}arg{n}'.format(prefix=prefix, n=n)
         if n < N:
             if n % 10:
                 content += ', '
@@ -106,6 +106,22 @@ def operator_declaration(N):
     return content
 
 
+@to_file('include/occa/core/kernelBindOperators.hpp')
+def bind_declarations(N):
+    return '\n\n'.join(
+        bind_declaration(n) for n in range(N + 1)
+    )
+
+
+def bind_declaration(N):
+    content = 'launchPlan bind('
+    indent = ' ' * len(content)
+    content += operator_args(N, indent, 'const kernelArg &')
+    content += ') const;'
+
+    return content
+
+
 @to_file('src/core/kernelOperators.cpp')
 def operator_definitions(N):
     return '\n'.join(
@@ -120,14 +136,14 @@ def operator_definition(N):
     if N > 0:
         content += ''') const {{
   assertInitialized();
-  kernelArg args[] = {{
+  const kernelArg *args[] = {{
     {array_args}
   }};
   modeKernel->setArguments(args, {N});
   run();
 }}
 '''.format(N=N,
-           array_args=array_args(N, ' ' * 4))
+           array_args=array_args(N, ' ' * 4, '&'))
     else:
         content += ''') const {
   modeKernel->arguments.clear();
@@ -137,6 +153,36 @@ def operator_definition(N):
     return content
 
 
+@to_file('src/core/kernelBindOperators.cpp')
+def bind_definitions(N):
+    return '\n'.join(
+        bind_definition(n) for n in range(N + 1)
+    )
+
+
+def bind_definition(N):
+    content = 'launchPlan kernel::bind('
+    indent = ' ' * len(content)
+    content += operator_args(N, indent, 'const kernelArg &')
+    if N > 0:
+        content += ''') const {{
+  assertInitialized();
+  const kernelArg *args[] = {{
+    {array_args}
+  }};
+  return launchPlan(*this, args, {N});
+}}
+'''.format(N=N,
+           array_args=array_args(N, ' ' * 4, '&'))
+    else:
+        content += ''') const {
+  assertInitialized();
+  return launchPlan(*this, NULL, 0);
+}
+'''
+    return content
+
+
 @to_file('include/occa/core/inlinedKernelScope.hpp')
 def inlined_kernel_scope_definitions(N):
     return '\n\n'.join(
@@ -185,4 +231,6 @@ if __name__ == '__main__':
     run_function_from_arguments(MAX_ARGS)
     operator_declarations(MAX_ARGS)
     operator_definitions(MAX_ARGS)
+    bind_declarations(MAX_ARGS)
+    bind_definitions(MAX_ARGS)
     inlined_kernel_scope_definitions(MAX_ARGS)
@@ -121,7 +121,7 @@ namespace occa {
               (__bridge id<MTLBuffer>) memory.getMetalBuffer().bufferObj
             );
             [computeEncoder setBuffer:metalBuffer
-                               offset:memory.getOffset()
+                               offset:(memory.getOffset() + arg.data.uint64_)
                               atIndex:index];
           } else {
             [computeEncoder setBytes:arg.ptr()
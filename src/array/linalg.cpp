@@ -111,5 +111,18 @@ namespace occa {
 
       return kernelBuilder::fromString(ss.str(), kernelName, props);
     }
+
+    occa::memory reductionBuffer(hashedMemoryMap &bufferMap,
+                                 occa::device device,
+                                 const udim_t bytes,
+                                 const occa::properties &props) {
+      memory &buffer = bufferMap[hash(device)];
+      // Not initialized or too small
+      if (!buffer.isInitialized() ||
+          (buffer.size() < bytes)) {
+        buffer = device.malloc(bytes, props);
+      }
+      return buffer;
+    }
   }
 }
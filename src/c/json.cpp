@@ -97,18 +97,18 @@ void OCCA_RFUNC occaJsonCastToObject(occaJson j) {
 
 //---[ Getters ]------------------------
 bool OCCA_RFUNC occaJsonGetBoolean(occaJson j) {
-  occa::json &j_ = occa::c::json(j);
+  const occa::json &j_ = occa::c::json(j);
   return j_.boolean();
 }
 
 occaType OCCA_RFUNC occaJsonGetNumber(occaJson j,
                                       const int type) {
-  occa::json &j_ = occa::c::json(j);
+  const occa::json &j_ = occa::c::json(j);
   return occa::c::newOccaType(j_.number(), type);
 }
 
 const char* OCCA_RFUNC occaJsonGetString(occaJson j) {
-  occa::json &j_ = occa::c::json(j);
+  const occa::json &j_ = occa::c::json(j);
   return j_.string().c_str();
 }
 //======================================
@@ -0,0 +1,109 @@
+#include <occa/core/asyncKernel.hpp>
+#include <occa/core/device.hpp>
+
+namespace occa {
+  asyncModeKernel_t::asyncModeKernel_t(modeDevice_t *modeDevice_,
+                                       const std::string &name_,
+                                       const std::string &sourceFilename_,
+                                       const occa::properties &properties_,
+                                       kernelFuture future_,
+                                       kernelFuture fallbackFuture_) :
+    occa::modeKernel_t(modeDevice_, name_, sourceFilename_, properties_),
+    future(future_),
+    fallbackFuture(fallbackFuture_),
+    activeKernel(NULL),
+    usingOptimizedKernel(false) {}
+
+  asyncModeKernel_t::~asyncModeKernel_t() {
+    activeKernel = NULL;
+  }
+
+  bool asyncModeKernel_t::isOptimized() const {
+    return usingOptimizedKernel;
+  }
+
+  modeKernel_t* asyncModeKernel_t::getOptimizedKernel() {
+    if (!usingOptimizedKernel) {
+      swapToOptimizedKernel();
+    }
+    return activeKernel;
+  }
+
+  modeKernel_t* asyncModeKernel_t::getLaunchKernel() {
+    if (usingOptimizedKernel) {
+      return activeKernel;
+    }
+
+    // Use the fallback kernel until the optimized kernel compiles
+    if (!future.isReady() && fallbackFuture.isInitialized()) {
+      if (!fallbackKernel.isInitialized()) {
+        fallbackKernel = fallbackFuture.get();
+        if (fallbackKernel.isInitialized()) {
+          activeKernel = fallbackKernel.getModeKernel();
+        }
+      }
+      if (activeKernel) {
+        return activeKernel;
+      }
+    }
+
+    return getOptimizedKernel();
+  }
+
+  void asyncModeKernel_t::swapToOptimizedKernel() {
+    optimizedKernel = future.get();
+
+    modeKernel_t *optimizedModeKernel = optimizedKernel.getModeKernel();
+    OCCA_ERROR("(" << name << ") Unable to build kernel asynchronously",
+               optimizedModeKernel != NULL);
+
+    hash = optimizedModeKernel->hash;
+    sourceFilename = optimizedModeKernel->sourceFilename;
+    binaryFilename = optimizedModeKernel->binaryFilename;
+    metadata = optimizedModeKernel->metadata;
+
+    activeKernel = optimizedModeKernel;
+    usingOptimizedKernel = true;
+
+    // The fallback is no longer needed
+    fallbackKernel = occa::kernel();
+    fallbackFuture = kernelFuture();
+  }
+
+  int asyncModeKernel_t::maxDims() const {
+    return const_cast<asyncModeKernel_t*>(this)->getLaunchKernel()->maxDims();
+  }
+
+  dim asyncModeKernel_t::maxOuterDims() const {
+    return const_cast<asyncModeKernel_t*>(this)->getLaunchKernel()->maxOuterDims();
+  }
+
+  dim asyncModeKernel_t::maxInnerDims() const {
+    return const_cast<asyncModeKernel_t*>(this)->getLaunchKernel()->maxInnerDims();
+  }
+
+  const lang::kernelMetadata_t& asyncModeKernel_t::getMetadata() const {
+    return const_cast<asyncModeKernel_t*>(this)->getLaunchKernel()->getMetadata();
+  }
+
+  void asyncModeKernel_t::setupRun() {
+    modeKernel_t &launchKernel = *(getLaunchKernel());
+
+    launchKernel.arguments = arguments;
+    launchKernel.outerDims = outerDims;
+    launchKernel.innerDims = innerDims;
+
+    launchKernel.setupRun();
+  }
+
+  void asyncModeKernel_t::setupValidatedRun() {
+    // The launch kernel can change between launches, validate
+    //   the arguments against whichever kernel is launched
+    setupRun();
+  }
+
+  void asyncModeKernel_t::run() const {
+    modeKernel_t *launchKernel = activeKernel;
+    launchKernel->run();
+  }
+}
@@ -1,5 +1,6 @@
 #include <occa/core/base.hpp>
 #include <occa/modes.hpp>
+#include <occa/tools/hostCopy.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/tools/tls.hpp>
@@ -70,6 +71,14 @@ namespace occa {
     return getDevice().tagStream();
   }
 
+  void beginCapture(const occa::properties &props) {
+    getDevice().beginCapture(props);
+  }
+
+  graph endCapture() {
+    return getDevice().endCapture();
+  }
+
   //---[ Kernel Functions ]-------------
   kernel buildKernel(const std::string &filename,
                      const std::string &kernelName,
@@ -94,6 +103,18 @@ namespace occa {
     return getDevice().buildKernelFromBinary(filename, kernelName, props);
   }
 
+  kernelFutureVector buildKernels(const kernelBuildRequestVector &requests) {
+    return getDevice().buildKernels(requests);
+  }
+
+  kernel buildKernelAsync(const std::string &filename,
+                          const std::string &kernelName,
+                          const occa::properties &props) {
+    return getDevice().buildKernelAsync(filename,
+                                        kernelName,
+                                        props);
+  }
+
   //---[ Memory Functions ]-------------
   occa::memory malloc(const dim_t entries,
                       const dtype_t &dtype,
@@ -123,15 +144,21 @@ namespace occa {
     return getDevice().umalloc(entries, dtype::byte, src, props);
   }
 
+  // Bytes written to [mem] at [offset] by a UVA copy
+  static udim_t uvaCopyBytes(modeMemory_t *mem,
+                             const udim_t offset,
+                             const dim_t bytes) {
+    return ((bytes == -1)
+            ? (mem->size - offset)
+            : (udim_t) bytes);
+  }
+
   void memcpy(void *dest, const void *src,
               const dim_t bytes,
               const occa::properties &props) {
 
-    ptrRangeMap::iterator srcIt  = uvaMap.find(const_cast<void*>(src));
-    ptrRangeMap::iterator destIt = uvaMap.find(dest);
-
-    occa::modeMemory_t *srcMem  = ((srcIt  != uvaMap.end()) ? (srcIt->second)  : NULL);
-    occa::modeMemory_t *destMem = ((destIt != uvaMap.end()) ? (destIt->second) : NULL);
+    occa::modeMemory_t *srcMem  = uvaMap.find(src);
+    occa::modeMemory_t *destMem = uvaMap.find(dest);
 
     const udim_t srcOff  = (srcMem
                             ? (((char*) src)  - srcMem->uvaPtr)
@@ -155,19 +182,27 @@ namespace occa {
                   : destMem->size);
       }
 
-      ::memcpy(dest, src, bytes_);
+      hostMemcpy(dest, src, bytes_);
+      if (destMem) {
+        destMem->markHostDirty(destOff, bytes_);
+      }
       return;
     }
 
     if (usingSrcPtr) {
       destMem->copyFrom(src, bytes, destOff, props);
+      destMem->markDeviceDirty(destOff, uvaCopyBytes(destMem, destOff, bytes));
     } else if (usingDestPtr) {
       srcMem->copyTo(dest, bytes, srcOff, props);
+      if (destMem) {
+        destMem->markHostDirty(destOff, uvaCopyBytes(destMem, destOff, bytes));
+      }
     } else {
       // Auto-detects peer-to-peer stuff
       occa::memory srcMemory(srcMem);
       occa::memory destMemory(destMem);
       destMemory.copyFrom(srcMemory, bytes, destOff, srcOff, props);
+      destMem->markDeviceDirty(destOff, uvaCopyBytes(destMem, destOff, bytes));
     }
   }
 
@@ -1,4 +1,7 @@
+#include <algorithm>
+
 #include <occa/core/device.hpp>
+#include <occa/core/asyncKernel.hpp>
 #include <occa/core/base.hpp>
 #include <occa/modes.hpp>
 #include <occa/tools/env.hpp>
@@ -11,7 +14,13 @@ namespace occa {
     mode((std::string) properties_["mode"]),
     properties(properties_),
     needsLauncherKernel(false),
-    bytesAllocated(0) {}
+    capturingGraph(NULL),
+    bytesAllocated(0),
+    maxBytesAllocated(0),
+    memoryPool(NULL),
+    kernelCacheHits(0),
+    kernelCacheMisses(0),
+    compilePool(NULL) {}
 
   modeDevice_t::~modeDevice_t() {
     // Null all wrappers
@@ -24,7 +33,20 @@ namespace occa {
 
   // Must be called before ~modeDevice_t()!
   void modeDevice_t::freeResources() {
+    // Wait for background compiles before freeing kernels
+    delete compilePool;
+    compilePool = NULL;
+    pendingKernelBuilds.clear();
+    cachedKernels.clear();
+    kernelRequestHashes.clear();
+
+    capturingGraph = NULL;
+    freeRing<modeGraph_t>(graphRing);
     freeRing<modeKernel_t>(kernelRing);
+
+    // Frees the cached blocks
+    delete memoryPool;
+    memoryPool = NULL;
     freeRing<modeMemory_t>(memoryRing);
     freeRing<modeStream_t>(streamRing);
     freeRing<modeStreamTag_t>(streamTagRing);
@@ -68,6 +90,9 @@ namespace occa {
 
   void modeDevice_t::removeStreamRef(modeStream_t *stream) {
     streamRing.removeRef(stream);
+    if (memoryPool) {
+      memoryPool->removeStream(stream);
+    }
   }
 
   void modeDevice_t::addStreamTagRef(modeStreamTag_t *streamTag) {
@@ -78,6 +103,28 @@ namespace occa {
     streamTagRing.removeRef(streamTag);
   }
 
+  void modeDevice_t::addGraphRef(modeGraph_t *graph) {
+    graphRing.addRef(graph);
+  }
+
+  void modeDevice_t::removeGraphRef(modeGraph_t *graph) {
+    graphRing.removeRef(graph);
+  }
+
+  modeGraph_t* modeDevice_t::createGraph(const occa::properties &props) {
+    return new modeGraph_t(this, props);
+  }
+
+  memoryPool_t* modeDevice_t::createMemoryPool(const occa::properties &props) {
+    return new memoryPool_t(this, props);
+  }
+
+  void modeDevice_t::setupMemoryPool() {
+    if (properties.get("memory_pool/enabled", false)) {
+      memoryPool = createMemoryPool(properties["memory_pool"]);
+    }
+  }
+
   hash_t modeDevice_t::versionedHash() const {
     return (occa::hash(settings()["version"])
             ^ hash());
@@ -111,25 +158,122 @@ namespace occa {
   }
 
   std::string modeDevice_t::getKernelHash(modeKernel_t *kernel) {
-    return getKernelHash(kernel->properties["hash"],
+    return getKernelHash(kernel->hash,
                          kernel->name);
   }
 
-  kernel& modeDevice_t::getCachedKernel(const hash_t &kernelHash,
-                                        const std::string &kernelName) {
+  modeKernel_t* modeDevice_t::findCachedKernel(const hash_t &kernelHash,
+                                               const std::string &kernelName) {
+    cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernelHash, kernelName));
+    return (it != cachedKernels.end()
+            ? it->second.front()
+            : NULL);
+  }
+
+  modeKernel_t* modeDevice_t::cloneCachedKernel(const hash_t &kernelHash,
+                                                const std::string &kernelName) {
+    modeKernel_t *cachedKernel = findCachedKernel(kernelHash, kernelName);
+    if (!cachedKernel) {
+      return NULL;
+    }
+    modeKernel_t *kernel = cachedKernel->clone();
+    if (kernel) {
+      kernel->hash = cachedKernel->hash;
+      addCachedKernel(kernel);
+    }
+    return kernel;
+  }
+
+  modeKernel_t* modeDevice_t::getCachedKernel(const hash_t &kernelHash,
+                                              const std::string &kernelName) {
+    modeKernel_t *kernel = cloneCachedKernel(kernelHash, kernelName);
+    if (kernel) {
+      ++kernelCacheHits;
+    } else {
+      ++kernelCacheMisses;
+    }
+    return kernel;
+  }
 
-    return cachedKernels[getKernelHash(kernelHash, kernelName)];
+  modeKernel_t* modeDevice_t::getRequestedKernel(const hash_t &requestHash,
+                                                 const std::string &kernelName) {
+    std::map<std::string, hash_t>::iterator it = (
+      kernelRequestHashes.find(getKernelHash(requestHash, kernelName))
+    );
+    if (it == kernelRequestHashes.end()) {
+      return NULL;
+    }
+    modeKernel_t *kernel = cloneCachedKernel(it->second, kernelName);
+    if (kernel) {
+      ++kernelCacheHits;
+    }
+    return kernel;
+  }
+
+  void modeDevice_t::addKernelRequest(const hash_t &requestHash,
+                                      modeKernel_t *kernel) {
+    if (kernel && kernel->hash.isInitialized()) {
+      kernelRequestHashes[getKernelHash(requestHash, kernel->name)] = kernel->hash;
+    }
+  }
+
+  void modeDevice_t::addCachedKernel(modeKernel_t *kernel) {
+    if (kernel && kernel->hash.isInitialized()) {
+      cachedKernels[getKernelHash(kernel)].push_back(kernel);
+    }
   }
 
   void modeDevice_t::removeCachedKernel(modeKernel_t *kernel) {
-    if (kernel == NULL) {
+    if (!kernel || !kernel->hash.isInitialized()) {
       return;
     }
     cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernel));
-    if (it != cachedKernels.end()) {
+    if (it == cachedKernels.end()) {
+      return;
+    }
+    std::vector<modeKernel_t*> &kernels = it->second;
+    kernels.erase(std::remove(kernels.begin(), kernels.end(), kernel),
+                  kernels.end());
+    if (kernels.empty()) {
       cachedKernels.erase(it);
     }
   }
+
+  threadPool& modeDevice_t::getCompilePool() {
+    if (!compilePool) {
+      compilePool = new threadPool(
+        properties.get("compile_jobs", threadPool::defaultThreadCount())
+      );
+    }
+    return *compilePool;
+  }
+
+  kernelBuildStatePtr modeDevice_t::getPendingKernelBuild(const hash_t &kernelHash) {
+    kernelBuildStateMap::iterator it = pendingKernelBuilds.find(kernelHash.getFullString());
+    if (it != pendingKernelBuilds.end()) {
+      return it->second;
+    }
+    return kernelBuildStatePtr();
+  }
+
+  void modeDevice_t::addPendingKernelBuild(kernelBuildStatePtr state) {
+    pendingKernelBuilds[state->kernelHash.getFullString()] = state;
+  }
+
+  void modeDevice_t::removePendingKernelBuild(kernelBuildState_t *state) {
+    kernelBuildStateMap::iterator it = pendingKernelBuilds.find(state->kernelHash.getFullString());
+    if ((it != pendingKernelBuilds.end())
+        && (it->second.get() == state)) {
+      pendingKernelBuilds.erase(it);
+    }
+  }
+
+  modeKernelBuild_t* modeDevice_t::startKernelBuild(const std::string &filename,
+                                                    const std::string &kernelName,
+                                                    const hash_t hash,
+                                                    const occa::properties &props) {
+    return new deferredKernelBuild_t(this, filename, kernelName, hash, props);
+  }
   //====================================
 
   //---[ device ]-----------------------
@@ -221,6 +365,7 @@ namespace occa {
     deviceProps["stream"] = initialObjectProps(mode_, "stream", props);
 
     setModeDevice(occa::newModeDevice(deviceProps));
+    modeDevice->setupMemoryPool();
 
     // Create an initial stream
     setStream(createStream());
@@ -254,6 +399,10 @@ namespace occa {
   }
 
   occa::properties device::kernelProperties(const occa::properties &additionalProps) const {
+    // Share the device properties, and their cached hash, when there is nothing to add
+    if (!additionalProps.size()) {
+      return kernelProperties();
+    }
     return (
       kernelProperties()
       + getModeSpecificProps(mode(), additionalProps)
@@ -266,6 +415,9 @@ namespace occa {
   }
 
   occa::properties device::memoryProperties(const occa::properties &additionalProps) const {
+    if (!additionalProps.size()) {
+      return memoryProperties();
+    }
     return (
       memoryProperties()
       + getModeSpecificProps(mode(), additionalProps)
@@ -278,6 +430,9 @@ namespace occa {
   }
 
   occa::properties device::streamProperties(const occa::properties &additionalProps) const {
+    if (!additionalProps.size()) {
+      return streamProperties();
+    }
     return (
       streamProperties()
       + getModeSpecificProps(mode(), additionalProps)
@@ -298,6 +453,18 @@ namespace occa {
     return 0;
   }
 
+  udim_t device::kernelCacheHits() const {
+    return (modeDevice
+            ? modeDevice->kernelCacheHits
+            : 0);
+  }
+
+  udim_t device::kernelCacheMisses() const {
+    return (modeDevice
+            ? modeDevice->kernelCacheMisses
+            : 0);
+  }
+
   udim_t device::memoryAllocated() const {
     if (modeDevice) {
       return modeDevice->bytesAllocated;
@@ -305,23 +472,57 @@ namespace occa {
     return 0;
   }
 
+  udim_t device::maxMemoryAllocated() const {
+    if (modeDevice) {
+      return modeDevice->maxBytesAllocated;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolBytes() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->bytesCached;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolHits() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->hits;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolMisses() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->misses;
+    }
+    return 0;
+  }
+
+  void device::trimMemoryPool() {
+    if (modeDevice && modeDevice->memoryPool) {
+      modeDevice->memoryPool->trim();
+    }
+  }
+
   void device::finish() {
     if (!modeDevice) {
       return;
     }
     if (modeDevice->hasSeparateMemorySpace()) {
-      const size_t staleEntries = uvaStaleMemory.size();
-      for (size_t i = 0; i < staleEntries; ++i) {
-        occa::modeMemory_t *mem = uvaStaleMemory[i];
-
-        mem->copyTo(mem->uvaPtr, mem->size, 0, "async: true");
+      staleMemoryList &uvaStaleMemory = modeDevice->uvaStaleMemory;
+      occa::modeMemory_t *mem;
+      while ((mem = uvaStaleMemory.pop())) {
+        if (mem->tracksDirtyRanges) {
+          mem->syncDirtyRangesToHost(0, mem->size, "async: true");
+        } else {
+          mem->copyTo(mem->uvaPtr, mem->size, 0, "async: true");
+        }
 
         mem->memInfo &= ~uvaFlag::inDevice;
         mem->memInfo &= ~uvaFlag::isStale;
       }
-      if (staleEntries) {
-        uvaStaleMemory.clear();
-      }
     }
 
     modeDevice->finish();
@@ -350,11 +551,19 @@ namespace occa {
 
   streamTag device::tagStream() {
     assertInitialized();
-    return modeDevice->tagStream();
+    streamTag tag = modeDevice->tagStream();
+    if (modeDevice->capturingGraph) {
+      modeDevice->capturingGraph->captureTag(tag.getModeStreamTag());
+    }
+    return tag;
   }
 
   void device::waitFor(streamTag tag) {
     assertInitialized();
+    if (modeDevice->capturingGraph) {
+      modeDevice->capturingGraph->captureWaitFor(tag.getModeStreamTag());
+      return;
+    }
     modeDevice->waitFor(tag);
   }
 
@@ -362,6 +571,29 @@ namespace occa {
     assertInitialized();
     return modeDevice->timeBetween(startTag, endTag);
   }
+
+  void device::beginCapture(const occa::properties &props) {
+    assertInitialized();
+    OCCA_ERROR("Device is already capturing a graph",
+               modeDevice->capturingGraph == NULL);
+    modeDevice->capturingGraph = modeDevice->createGraph(props);
+  }
+
+  occa::graph device::endCapture() {
+    assertInitialized();
+    modeGraph_t *modeGraph = modeDevice->capturingGraph;
+    OCCA_ERROR("Device is not capturing a graph",
+               modeGraph != NULL);
+
+    modeDevice->capturingGraph = NULL;
+    modeGraph->endCapture();
+    return occa::graph(modeGraph);
+  }
+
+  bool device::isCapturing() const {
+    return (modeDevice
+            && modeDevice->capturingGraph);
+  }
   //  |=================================
 
   //  |---[ Kernel ]--------------------
@@ -383,7 +615,7 @@ namespace occa {
     kernelHash = applyDependencyHash(kernelHash);
   }
 
-  hash_t device::applyDependencyHash(const hash_t &kernelHash) const {
+  hash_t device::applyDependencyHash(const hash_t &kernelHash) {
     // Check if the build.json exists to compare dependencies
     const std::string buildFile = io::hashDir(kernelHash) + kc::buildFile;
     if (!io::exists(buildFile)) {
@@ -428,22 +660,39 @@ namespace occa {
     return kernelHash;
   }
 
+  hash_t device::kernelRequestHash(const hash_t &sourceHash,
+                                   const occa::properties &props) const {
+    return (
+      hash()
+      ^ kernelProperties().hash()
+      ^ props.hash()
+      ^ sourceHash
+    );
+  }
+
   kernel device::buildKernel(const std::string &filename,
                              const std::string &kernelName,
                              const occa::properties &props) const {
+    assertInitialized();
+
+    // Kernels that are still alive are found without touching the source
+    const hash_t requestHash = kernelRequestHash(occa::hash(filename), props);
+    modeKernel_t *modeKernel = modeDevice->getRequestedKernel(requestHash, kernelName);
+    if (modeKernel) {
+      return kernel(modeKernel);
+    }
+
     occa::properties allProps;
     hash_t kernelHash;
     const std::string realFilename = io::findInPaths(filename, env::OCCA_KERNEL_PATH);
     setupKernelInfo(props, hashFile(realFilename),
                     allProps, kernelHash);
 
-    // TODO: [#185] Fix kernel cache frees
-    // // Check cache first
-    // kernel &cachedKernel = modeDevice->getCachedKernel(kernelHash,
-    //                                                    kernelName);
-    // if (cachedKernel.isInitialized()) {
-    //   return cachedKernel;
-    // }
+    modeKernel = modeDevice->getCachedKernel(kernelHash, kernelName);
+    if (modeKernel) {
+      modeDevice->addKernelRequest(requestHash, modeKernel);
+      return kernel(modeKernel);
+    }
 
     const std::string hashDir = io::hashDir(realFilename, kernelHash);
     allProps["hash"] = kernelHash.getFullString();
@@ -455,6 +704,8 @@ namespace occa {
 
     if (cachedKernel.isInitialized()) {
       cachedKernel.modeKernel->hash = kernelHash;
+      modeDevice->addCachedKernel(cachedKernel.modeKernel);
+      modeDevice->addKernelRequest(requestHash, cachedKernel.modeKernel);
     } else {
       sys::rmrf(hashDir);
     }
@@ -465,11 +716,29 @@ namespace occa {
   kernel device::buildKernelFromString(const std::string &content,
                                        const std::string &kernelName,
                                        const occa::properties &props) const {
+    assertInitialized();
+
+    const hash_t sourceHash = occa::hash(content);
+    const hash_t requestHash = kernelRequestHash(sourceHash, props);
+    modeKernel_t *modeKernel = modeDevice->getRequestedKernel(requestHash, kernelName);
+    if (modeKernel) {
+      return kernel(modeKernel);
+    }
+
     occa::properties allProps;
     hash_t kernelHash;
-    setupKernelInfo(props, occa::hash(content),
+    setupKernelInfo(props, sourceHash,
                     allProps, kernelHash);
 
+    // The string source file hashes to the same kernel hash,
+    //   buildKernel() counts the cache miss
+    modeKernel = modeDevice->cloneCachedKernel(kernelHash, kernelName);
+    if (modeKernel) {
+      ++modeDevice->kernelCacheHits;
+      modeDevice->addKernelRequest(requestHash, modeKernel);
+      return kernel(modeKernel);
+    }
+
     io::lock_t lock(kernelHash, "occa-device");
     std::string stringSourceFile = io::hashDir(kernelHash);
     stringSourceFile += "string_source.cpp";
@@ -481,9 +750,179 @@ namespace occa {
       lock.release();
     }
 
-    return buildKernel(stringSourceFile,
-                       kernelName,
-                       props);
+    kernel stringKernel = buildKernel(stringSourceFile,
+                                      kernelName,
+                                      props);
+    modeDevice->addKernelRequest(requestHash, stringKernel.modeKernel);
+    return stringKernel;
+  }
+
+  kernelFuture device::startKernelBuild(const std::string &filename,
+                                        const std::string &kernelName,
+                                        const occa::properties &props) const {
+    assertInitialized();
+
+    kernelBuildStatePtr state;
+
+    const hash_t requestHash = kernelRequestHash(occa::hash(filename), props);
+    modeKernel_t *requestedKernel = modeDevice->getRequestedKernel(requestHash, kernelName);
+    if (requestedKernel) {
+      state = std::make_shared<kernelBuildState_t>(modeDevice, (modeKernelBuild_t*) NULL);
+      state->kernel = requestedKernel;
+      state->compiled = true;
+      state->finished = true;
+      return kernelFuture(state);
+    }
+
+    occa::properties allProps;
+    hash_t kernelHash;
+    const std::string realFilename = io::findInPaths(filename, env::OCCA_KERNEL_PATH);
+    setupKernelInfo(props, hashFile(realFilename),
+                    allProps, kernelHash);
+
+    allProps["hash"] = kernelHash.getFullString();
+
+    kernelBuildStatePtr sharedBuild = modeDevice->getPendingKernelBuild(kernelHash);
+
+    modeKernel_t *cachedKernel = (
+      sharedBuild
+      ? NULL
+      : modeDevice->getCachedKernel(kernelHash, kernelName)
+    );
+    if (cachedKernel) {
+      // Already built, the future is ready
+      modeDevice->addKernelRequest(requestHash, cachedKernel);
+      state = std::make_shared<kernelBuildState_t>(modeDevice, (modeKernelBuild_t*) NULL);
+      state->kernel = cachedKernel;
+      state->compiled = true;
+      state->finished = true;
+      return kernelFuture(state);
+    }
+
+    if (sharedBuild) {
+      // Kernels from the same source share the compiled binary
+      state = std::make_shared<kernelBuildState_t>(modeDevice, (modeKernelBuild_t*) NULL);
+      state->sharedBuild = sharedBuild;
+    } else {
+      state = std::make_shared<kernelBuildState_t>(
+        modeDevice,
+        modeDevice->startKernelBuild(realFilename,
+                                     kernelName,
+                                     kernelHash,
+                                     allProps)
+      );
+    }
+
+    state->filename    = realFilename;
+    state->kernelName  = kernelName;
+    state->props       = props;
+    state->requestHash = requestHash;
+    state->kernelHash  = kernelHash;
+
+    if (!sharedBuild) {
+      modeDevice->addPendingKernelBuild(state);
+      if (state->build->needsCompile()) {
+        modeDevice->getCompilePool().push(
+          std::bind(&kernelBuildState_t::compile, state)
+        );
+      } else {
+        state->compile();
+      }
+    }
+
+    return kernelFuture(state);
+  }
+
+  kernelFuture device::startPooledKernelBuild(const std::string &filename,
+                                              const std::string &kernelName,
+                                              const occa::properties &props) const {
+    kernelBuildStatePtr state = std::make_shared<kernelBuildState_t>(
+      modeDevice, (modeKernelBuild_t*) NULL
+    );
+
+    const hash_t requestHash = kernelRequestHash(occa::hash(filename), props);
+    modeKernel_t *requestedKernel = modeDevice->getRequestedKernel(requestHash, kernelName);
+    if (requestedKernel) {
+      state->kernel = requestedKernel;
+      state->compiled = true;
+      state->finished = true;
+      return kernelFuture(state);
+    }
+
+    // Device properties are only read here, setup() adds
+    //   the source hash like setupKernelInfo() does
+    const occa::properties kernelProps = kernelProperties(props);
+
+    state->filename    = filename;
+    state->kernelName  = kernelName;
+    state->props       = props;
+    state->requestHash = requestHash;
+    state->kernelHash  = (
+      hash()
+      ^ modeDevice->kernelHash(kernelProps)
+      ^ kernelHeaderHash(kernelProps)
+    );
+    state->setupInPool = true;
+    state->kernelProps = kernelProps;
+    state->settings    = occa::settings();
+
+    modeDevice->getCompilePool().push(
+      std::bind(&kernelBuildState_t::compile, state)
+    );
+
+    return kernelFuture(state);
+  }
+
+  kernelFutureVector device::buildKernels(const kernelBuildRequestVector &requests) const {
+    assertInitialized();
+
+    const int requestCount = (int) requests.size();
+    kernelFutureVector futures;
+    futures.reserve(requestCount);
+
+    for (int i = 0; i < requestCount; ++i) {
+      const kernelBuildRequest &request = requests[i];
+      futures.push_back(
+        startKernelBuild(request.filename,
+                         request.kernelName,
+                         request.props)
+      );
+    }
+
+    return futures;
+  }
+
+  kernel device::buildKernelAsync(const std::string &filename,
+                                  const std::string &kernelName,
+                                  const occa::properties &props) const {
+    assertInitialized();
+
+    occa::properties kernelProps = props;
+    kernelFuture fallbackFuture;
+
+    // Launches use the fallback build until the optimized build is ready,
+    //   it's queued first so it finishes first
+    if (kernelProps.has("fallback")) {
+      occa::properties fallbackProps = kernelProps["fallback"];
+      kernelProps.remove("fallback");
+
+      fallbackFuture = startPooledKernelBuild(filename,
+                                              kernelName,
+                                              fallbackProps);
+    }
+
+    kernelFuture future = startPooledKernelBuild(filename,
+                                                 kernelName,
+                                                 kernelProps);
+
+    return kernel(
+      new asyncModeKernel_t(modeDevice,
+                            kernelName,
+                            filename,
+                            kernelProperties(kernelProps),
+                            future,
+                            fallbackFuture)
+    );
   }
 
   kernel device::buildKernelFromBinary(const std::string &filename,
@@ -572,10 +1011,17 @@ namespace occa {
 
     occa::properties memProps = memoryProperties(props);
 
-    memory mem(modeDevice->malloc(bytes, src, memProps));
+    memory mem(
+      modeDevice->memoryPool
+      ? modeDevice->memoryPool->malloc(bytes, src, memProps)
+      : modeDevice->malloc(bytes, src, memProps)
+    );
     mem.setDtype(dtype);
 
     modeDevice->bytesAllocated += bytes;
+    if (modeDevice->maxBytesAllocated < modeDevice->bytesAllocated) {
+      modeDevice->maxBytesAllocated = modeDevice->bytesAllocated;
+    }
 
     return mem;
   }
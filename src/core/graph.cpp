@@ -0,0 +1,404 @@
+#include <algorithm>
+
+#include <occa/core/device.hpp>
+#include <occa/core/graph.hpp>
+#include <occa/core/kernel.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/core/stream.hpp>
+#include <occa/core/streamTag.hpp>
+
+namespace occa {
+  //---[ graphNode ]--------------------
+  graphNode::graphNode() :
+    type(0),
+    modeStream(NULL),
+    modeKernel(NULL),
+    destMemory(NULL),
+    srcMemory(NULL),
+    destPtr(NULL),
+    srcPtr(NULL),
+    bytes(0),
+    destOffset(0),
+    srcOffset(0) {}
+
+  bool graphNode::isValid() const {
+    if (!stream.isInitialized()) {
+      return false;
+    }
+    if ((type & graphNodeType::kernel)
+        && !kernel.getModeKernel()) {
+      return false;
+    }
+    const int memoryCount = (int) memories.size();
+    for (int i = 0; i < memoryCount; ++i) {
+      if (!memories[i].isInitialized()) {
+        return false;
+      }
+    }
+    return true;
+  }
+  //====================================
+
+  //---[ modeGraph_t ]------------------
+  modeGraph_t::modeGraph_t(modeDevice_t *modeDevice_,
+                           const occa::properties &properties_) :
+    properties(properties_),
+    modeDevice(modeDevice_) {
+    modeDevice->addGraphRef(this);
+  }
+
+  modeGraph_t::~modeGraph_t() {
+    // NULL all wrappers
+    while (graphRing.head) {
+      graph *g = (graph*) graphRing.head;
+      graphRing.removeRef(g);
+      g->modeGraph = NULL;
+    }
+    // Remove ref from device
+    if (modeDevice) {
+      if (modeDevice->capturingGraph == this) {
+        modeDevice->capturingGraph = NULL;
+      }
+      modeDevice->removeGraphRef(this);
+    }
+  }
+
+  void modeGraph_t::dontUseRefs() {
+    graphRing.dontUseRefs();
+  }
+
+  void modeGraph_t::addGraphRef(graph *g) {
+    graphRing.addRef(g);
+  }
+
+  void modeGraph_t::removeGraphRef(graph *g) {
+    graphRing.removeRef(g);
+  }
+
+  bool modeGraph_t::needsFree() const {
+    return graphRing.needsFree();
+  }
+
+  bool modeGraph_t::isValid() const {
+    const int nodeCount = (int) nodes.size();
+    for (int i = 0; i < nodeCount; ++i) {
+      if (!nodes[i].isValid()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //---[ Capture ]----------------------
+  void modeGraph_t::captureKernel(modeKernel_t &modeKernel) {
+    graphNode node;
+    node.type = graphNodeType::kernel;
+    node.modeKernel = &modeKernel;
+    node.arguments = modeKernel.arguments;
+    node.outerDims = modeKernel.outerDims;
+    node.innerDims = modeKernel.innerDims;
+    node.kernel = &modeKernel;
+
+    // Replays can't read values from the caller's (long gone) objects
+    const int argc = (int) node.arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      kernelArgData &arg = node.arguments[i];
+      arg.ownValue();
+      modeMemory_t *argMemory = arg.getModeMemory();
+      if (argMemory) {
+        node.memories.push_back(memory(argMemory));
+      }
+    }
+    addNode(node);
+  }
+
+  void modeGraph_t::captureCopy(modeMemory_t *destMemory,
+                                void *destPtr,
+                                modeMemory_t *srcMemory,
+                                const void *srcPtr,
+                                const udim_t bytes,
+                                const udim_t destOffset,
+                                const udim_t srcOffset,
+                                const occa::properties &props) {
+    graphNode node;
+    node.type = graphNodeType::copy;
+    node.destMemory = destMemory;
+    node.srcMemory = srcMemory;
+    node.destPtr = destPtr;
+    node.srcPtr = srcPtr;
+    node.bytes = bytes;
+    node.destOffset = destOffset;
+    node.srcOffset = srcOffset;
+    node.props = props;
+    if (destMemory) {
+      node.memories.push_back(memory(destMemory));
+    }
+    if (srcMemory) {
+      node.memories.push_back(memory(srcMemory));
+    }
+    addNode(node);
+  }
+
+  void modeGraph_t::captureTag(modeStreamTag_t *modeStreamTag) {
+    std::map<modeStream_t*, int>::iterator it = (
+      lastStreamNodes.find(getCurrentModeStream())
+    );
+    // Tags before any captured work don't add dependencies
+    tagNodes[modeStreamTag] = ((it != lastStreamNodes.end())
+                               ? it->second
+                               : -1);
+  }
+
+  void modeGraph_t::captureWaitFor(modeStreamTag_t *modeStreamTag) {
+    std::map<modeStreamTag_t*, int>::iterator it = tagNodes.find(modeStreamTag);
+    // Tags from before the capture refer to work that isn't replayed
+    if ((it == tagNodes.end()) || (it->second < 0)) {
+      return;
+    }
+    pendingStreamWaits[getCurrentModeStream()].push_back(it->second);
+  }
+
+  void modeGraph_t::endCapture() {
+    lastStreamNodes.clear();
+    pendingStreamWaits.clear();
+    tagNodes.clear();
+    finishCapture();
+  }
+
+  modeStream_t* modeGraph_t::getCurrentModeStream() const {
+    return modeDevice->currentStream.getModeStream();
+  }
+
+  void modeGraph_t::addNode(graphNode &node) {
+    modeStream_t *modeStream = getCurrentModeStream();
+    const int index = (int) nodes.size();
+
+    node.modeStream = modeStream;
+    node.stream = modeDevice->currentStream;
+
+    std::map<modeStream_t*, int>::iterator lastIt = lastStreamNodes.find(modeStream);
+    if (lastIt != lastStreamNodes.end()) {
+      node.dependencies.push_back(lastIt->second);
+    }
+
+    std::map<modeStream_t*, std::vector<int> >::iterator waitIt = (
+      pendingStreamWaits.find(modeStream)
+    );
+    if (waitIt != pendingStreamWaits.end()) {
+      const std::vector<int> &waits = waitIt->second;
+      const int waitCount = (int) waits.size();
+      for (int i = 0; i < waitCount; ++i) {
+        if (std::find(node.dependencies.begin(),
+                      node.dependencies.end(),
+                      waits[i]) == node.dependencies.end()) {
+          node.dependencies.push_back(waits[i]);
+        }
+      }
+      pendingStreamWaits.erase(waitIt);
+    }
+
+    nodes.push_back(node);
+    lastStreamNodes[modeStream] = index;
+  }
+
+  void modeGraph_t::runNode(graphNode &node) {
+    if (node.type & graphNodeType::kernel) {
+      // Arguments were validated when they were captured
+      modeKernel_t &modeKernel = *(node.modeKernel);
+      modeKernel.arguments = node.arguments;
+      modeKernel.outerDims = node.outerDims;
+      modeKernel.innerDims = node.innerDims;
+      modeKernel.setupValidatedRun();
+      modeKernel.run();
+      return;
+    }
+
+    if (node.destMemory && node.srcMemory) {
+      node.destMemory->copyFrom(node.srcMemory,
+                                node.bytes,
+                                node.destOffset,
+                                node.srcOffset,
+                                node.props);
+    } else if (node.destMemory) {
+      node.destMemory->copyFrom(node.srcPtr,
+                                node.bytes,
+                                node.destOffset,
+                                node.props);
+    } else {
+      node.srcMemory->copyTo(node.destPtr,
+                             node.bytes,
+                             node.srcOffset,
+                             node.props);
+    }
+  }
+  //====================================
+
+  void modeGraph_t::finishCapture() {}
+
+  void modeGraph_t::run() {
+    const int nodeCount = (int) nodes.size();
+    if (!nodeCount) {
+      return;
+    }
+
+    // Only nodes other streams wait on need a tag
+    std::vector<bool> needsTag(nodeCount, false);
+    for (int i = 0; i < nodeCount; ++i) {
+      const graphNode &node = nodes[i];
+      const int depCount = (int) node.dependencies.size();
+      for (int d = 0; d < depCount; ++d) {
+        const int dep = node.dependencies[d];
+        if (nodes[dep].modeStream != node.modeStream) {
+          needsTag[dep] = true;
+        }
+      }
+    }
+
+    const stream previousStream = modeDevice->currentStream;
+    std::vector<streamTag> nodeTags(nodeCount);
+
+    for (int i = 0; i < nodeCount; ++i) {
+      graphNode &node = nodes[i];
+      if (node.modeStream != modeDevice->currentStream.getModeStream()) {
+        modeDevice->currentStream = stream(node.modeStream);
+      }
+
+      const int depCount = (int) node.dependencies.size();
+      for (int d = 0; d < depCount; ++d) {
+        const int dep = node.dependencies[d];
+        if (nodes[dep].modeStream != node.modeStream) {
+          modeDevice->waitFor(nodeTags[dep]);
+        }
+      }
+
+      runNode(node);
+
+      if (needsTag[i]) {
+        nodeTags[i] = modeDevice->tagStream();
+      }
+    }
+
+    modeDevice->currentStream = previousStream;
+  }
+  //====================================
+
+  //---[ graph ]------------------------
+  graph::graph() :
+    modeGraph(NULL) {}
+
+  graph::graph(modeGraph_t *modeGraph_) :
+    modeGraph(NULL) {
+    setModeGraph(modeGraph_);
+  }
+
+  graph::graph(const graph &g) :
+    modeGraph(NULL) {
+    setModeGraph(g.modeGraph);
+  }
+
+  graph& graph::operator = (const graph &g) {
+    setModeGraph(g.modeGraph);
+    return *this;
+  }
+
+  graph::~graph() {
+    removeGraphRef();
+  }
+
+  void graph::assertInitialized() const {
+    OCCA_ERROR("Graph not initialized or has been freed",
+               modeGraph != NULL);
+  }
+
+  void graph::setModeGraph(modeGraph_t *modeGraph_) {
+    if (modeGraph != modeGraph_) {
+      removeGraphRef();
+      modeGraph = modeGraph_;
+      if (modeGraph) {
+        modeGraph->addGraphRef(this);
+      }
+    }
+  }
+
+  void graph::removeGraphRef() {
+    if (!modeGraph) {
+      return;
+    }
+    modeGraph->removeGraphRef(this);
+    if (modeGraph->modeGraph_t::needsFree()) {
+      free();
+    }
+  }
+
+  void graph::dontUseRefs() {
+    if (modeGraph) {
+      modeGraph->modeGraph_t::dontUseRefs();
+    }
+  }
+
+  bool graph::isInitialized() const {
+    return (modeGraph != NULL);
+  }
+
+  modeGraph_t* graph::getModeGraph() const {
+    return modeGraph;
+  }
+
+  modeDevice_t* graph::getModeDevice() const {
+    return modeGraph->modeDevice;
+  }
+
+  occa::device graph::getDevice() const {
+    return occa::device(modeGraph
+                        ? modeGraph->modeDevice
+                        : NULL);
+  }
+
+  const std::string& graph::mode() const {
+    static const std::string noMode = "No Mode";
+    return (modeGraph
+            ? modeGraph->modeDevice->mode
+            : noMode);
+  }
+
+  const occa::properties& graph::properties() const {
+    static const occa::properties noProperties;
+    return (modeGraph
+            ? modeGraph->properties
+            : noProperties);
+  }
+
+  int graph::size() const {
+    return (modeGraph
+            ? (int) modeGraph->nodes.size()
+            : 0);
+  }
+
+  void graph::run() const {
+    assertInitialized();
+    OCCA_ERROR("Graphs can't be launched while capturing a graph",
+               modeGraph->modeDevice->capturingGraph == NULL);
+    OCCA_ERROR("Graph uses a kernel, memory or stream that was freed",
+               modeGraph->isValid());
+    modeGraph->run();
+  }
+
+  void graph::operator () () const {
+    run();
+  }
+
+  bool graph::operator == (const occa::graph &other) const {
+    return (modeGraph == other.modeGraph);
+  }
+
+  bool graph::operator != (const occa::graph &other) const {
+    return (modeGraph != other.modeGraph);
+  }
+
+  void graph::free() {
+    // ~modeGraph_t NULLs all wrappers
+    delete modeGraph;
+    modeGraph = NULL;
+  }
+  //====================================
+}
@@ -1,5 +1,6 @@
 #include <occa/core/device.hpp>
 #include <occa/core/kernel.hpp>
+#include <occa/core/launchPlan.hpp>
 #include <occa/core/memory.hpp>
 #include <occa/io.hpp>
 #include <occa/lang/builtins/types.hpp>
@@ -16,7 +17,9 @@ namespace occa {
     modeDevice(modeDevice_),
     name(name_),
     sourceFilename(sourceFilename_),
-    properties(properties_) {
+    properties(properties_),
+    typeValidation(properties_.get("type_validation", true)),
+    hasValidatedArgTypes(false) {
     modeDevice->addKernelRef(this);
   }
 
@@ -29,6 +32,7 @@ namespace occa {
     }
     // Remove ref from device
     if (modeDevice) {
+      modeDevice->removeCachedKernel(this);
       modeDevice->removeKernelRef(this);
     }
   }
@@ -62,12 +66,12 @@ namespace occa {
                !argDevice || (argDevice == modeDevice));
   }
 
-  void modeKernel_t::setArguments(kernelArg *args,
+  void modeKernel_t::setArguments(const kernelArg * const *args,
                                   const int count) {
+    // Keeps the capacity from previous launches
     arguments.clear();
-    arguments.reserve(count);
     for (int i = 0; i < count; ++i) {
-      pushArgument(args[i]);
+      pushArgument(*(args[i]));
     }
   }
 
@@ -82,52 +86,90 @@ namespace occa {
     assertArgumentLimit();
   }
 
-  void modeKernel_t::setupRun() {
+  // Memory arguments are told apart by their dtype, null memory
+  //   arguments match any pointer argument
+  static const void* getArgType(const kernelArgData &arg) {
+    if (arg.isNull()) {
+      return &nullKernelArg;
+    }
+    return (const void*) arg.getDtype();
+  }
+
+  bool modeKernel_t::validatesArgTypes() const {
+    return (typeValidation && metadata.isInitialized());
+  }
+
+  bool modeKernel_t::argTypesAreValidated() const {
     const int argc = (int) arguments.size();
+    if (!hasValidatedArgTypes
+        || (argc != (int) validatedArgTypes.size())) {
+      return false;
+    }
+    for (int i = 0; i < argc; ++i) {
+      if (getArgType(arguments[i]) != validatedArgTypes[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
 
-    const bool validateTypes = (
-      metadata.isInitialized()
-      && properties.get("type_validation", true)
-    );
+  void modeKernel_t::validateArgTypes() {
+    const int argc = (int) arguments.size();
+    const int metaArgc = (int) metadata.arguments.size();
 
-    if (validateTypes) {
-      const int metaArgc = (int) metadata.arguments.size();
+    hasValidatedArgTypes = false;
 
-      OCCA_ERROR("(" << name << ") Kernel expects ["
-                 << metaArgc << "] argument"
-                 << (metaArgc != 1 ? "s," : ",")
-                 << " received ["
-                 << argc << ']',
-                 argc == metaArgc);
+    OCCA_ERROR("(" << name << ") Kernel expects ["
+               << metaArgc << "] argument"
+               << (metaArgc != 1 ? "s," : ",")
+               << " received ["
+               << argc << ']',
+               argc == metaArgc);
 
-      // TODO: Get original arg #
-      for (int i = 0; i < argc; ++i) {
-        kernelArgData &arg = arguments[i];
-        lang::argMetadata_t &argInfo = metadata.arguments[i];
-
-        modeMemory_t *mem = arg.getModeMemory();
-        const bool isNull = arg.isNull();
-        const bool isPtr = mem || isNull;
-        if (isPtr != argInfo.isPtr) {
-          if (argInfo.isPtr) {
-            OCCA_FORCE_ERROR("(" << name << ") Kernel expects an occa::memory for argument ["
-                             << (i + 1) << "]");
-          } else {
-            OCCA_FORCE_ERROR("(" << name << ") Kernel expects a non-occa::memory type for argument ["
-                             << (i + 1) << "]");
-          }
-        }
+    // TODO: Get original arg #
+    for (int i = 0; i < argc; ++i) {
+      kernelArgData &arg = arguments[i];
+      lang::argMetadata_t &argInfo = metadata.arguments[i];
 
-        if (!isPtr || isNull) {
-          continue;
+      modeMemory_t *mem = arg.getModeMemory();
+      const bool isNull = arg.isNull();
+      const bool isPtr = mem || isNull;
+      if (isPtr != argInfo.isPtr) {
+        if (argInfo.isPtr) {
+          OCCA_FORCE_ERROR("(" << name << ") Kernel expects an occa::memory for argument ["
+                           << (i + 1) << "]");
+        } else {
+          OCCA_FORCE_ERROR("(" << name << ") Kernel expects a non-occa::memory type for argument ["
+                           << (i + 1) << "]");
         }
+      }
 
-        OCCA_ERROR("(" << name << ") Argument [" << (i + 1) << "] has wrong runtime type.\n"
-                   << "Expected type: " << argInfo.dtype << '\n'
-                   << "Received type: " << *(mem->dtype_) << '\n',
-                   mem->dtype_->canBeCastedTo(argInfo.dtype));
+      if (!isPtr || isNull) {
+        continue;
+      }
+
+      OCCA_ERROR("(" << name << ") Argument [" << (i + 1) << "] has wrong runtime type.\n"
+                 << "Expected type: " << argInfo.dtype << '\n'
+                 << "Received type: " << *(arg.getDtype()) << '\n',
+                 arg.getDtype()->canBeCastedTo(argInfo.dtype));
+    }
 
-        arg.setupForKernelCall(argInfo.isConst);
+    validatedArgTypes.resize(argc);
+    for (int i = 0; i < argc; ++i) {
+      validatedArgTypes[i] = getArgType(arguments[i]);
+    }
+    hasValidatedArgTypes = true;
+  }
+
+  void modeKernel_t::setupArgumentsForRun() {
+    const int argc = (int) arguments.size();
+
+    if (validatesArgTypes()) {
+      for (int i = 0; i < argc; ++i) {
+        kernelArgData &arg = arguments[i];
+        if (arg.getModeMemory() && !arg.isNull()) {
+          arg.setupForKernelCall(metadata.arguments[i].isConst);
+        }
       }
       return;
     }
@@ -142,6 +184,22 @@ namespace occa {
       }
     }
   }
+
+  void modeKernel_t::setupRun() {
+    if (validatesArgTypes() && !argTypesAreValidated()) {
+      validateArgTypes();
+    }
+    setupArgumentsForRun();
+  }
+
+  void modeKernel_t::setupValidatedRun() {
+    setupArgumentsForRun();
+  }
+
+  modeKernel_t* modeKernel_t::clone() const {
+    return NULL;
+  }
+
   //====================================
 
   //---[ kernel ]-----------------------
@@ -306,11 +364,19 @@ namespace occa {
     assertInitialized();
 
     modeKernel->setupRun();
+
+    modeGraph_t *capturingGraph = modeKernel->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->captureKernel(*modeKernel);
+      return;
+    }
     modeKernel->run();
   }
 
 #include "kernelOperators.cpp"
 
+#include "kernelBindOperators.cpp"
+
   void kernel::free() {
     // ~modeKernel_t NULLs all wrappers
     delete modeKernel;
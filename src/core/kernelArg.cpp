@@ -9,6 +9,7 @@ namespace occa {
 
   kernelArgData::kernelArgData() :
     modeMemory(NULL),
+    dtype(NULL),
     size(0),
     info(kArgInfo::none) {
     ::memset(&data, 0, sizeof(data));
@@ -16,16 +17,20 @@ namespace occa {
 
   kernelArgData::kernelArgData(const kernelArgData &other) :
       modeMemory(other.modeMemory),
+      dtype(other.dtype),
       data(other.data),
       size(other.size),
-      info(other.info) {}
+      info(other.info),
+      ownedValue(other.ownedValue) {}
 
   kernelArgData& kernelArgData::operator = (const kernelArgData &other) {
     modeMemory = other.modeMemory;
+    dtype = other.dtype;
 
     data = other.data;
     size = other.size;
     info = other.info;
+    ownedValue = other.ownedValue;
 
     return *this;
   }
@@ -43,6 +48,13 @@ namespace occa {
     return modeMemory;
   }
 
+  const dtype_t* kernelArgData::getDtype() const {
+    if (dtype || !modeMemory) {
+      return dtype;
+    }
+    return modeMemory->dtype_;
+  }
+
   void* kernelArgData::ptr() const {
     if (!isNull()) {
       if (info & kArgInfo::usePointer) {
@@ -58,22 +70,58 @@ namespace occa {
     return (info & kArgInfo::isNull);
   }
 
+  void kernelArgData::ownValue() {
+    if (!(info & kArgInfo::pointsToValue) || ownedValue) {
+      return;
+    }
+    const char *value = (const char*) data.void_;
+    ownedValue = std::make_shared<std::vector<char>>(value, value + size);
+    data.void_ = (void*) ownedValue->data();
+  }
+
   void kernelArgData::setupForKernelCall(const bool isConst) const {
     if (!modeMemory              ||
         !modeMemory->isManaged() ||
         !modeMemory->modeDevice->hasSeparateMemorySpace()) {
       return;
     }
-    if (!modeMemory->inDevice()) {
+    if (modeMemory->tracksDirtyRanges) {
+      // Only host writes are copied, even if the memory is in the device
+      modeMemory->syncDirtyRangesToDevice(0, modeMemory->size);
+      modeMemory->memInfo |= uvaFlag::inDevice;
+    } else if (!modeMemory->inDevice()) {
       modeMemory->copyFrom(modeMemory->uvaPtr, modeMemory->size);
       modeMemory->memInfo |= uvaFlag::inDevice;
     }
-    if (!isConst && !modeMemory->isStale()) {
-      uvaStaleMemory.push_back(modeMemory);
+    if (isConst) {
+      return;
+    }
+    if (modeMemory->tracksDirtyRanges) {
+      // Kernels can write anywhere in the memory
+      modeMemory->markDeviceDirty(0, modeMemory->size);
+    } else if (!modeMemory->isStale()) {
       modeMemory->memInfo |= uvaFlag::isStale;
+      modeMemory->modeDevice->uvaStaleMemory.push(modeMemory);
     }
   }
 
+  kArgVector::kArgVector() :
+    count(0) {}
+
+  void kArgVector::push_back(const kernelArgData &arg) {
+    if (count < inlineCapacity) {
+      inlineArgs[count] = arg;
+    } else {
+      extraArgs.push_back(arg);
+    }
+    ++count;
+  }
+
+  void kArgVector::clear() {
+    extraArgs.clear();
+    count = 0;
+  }
+
   kernelArg::kernelArg() {}
   kernelArg::~kernelArg() {}
 
@@ -224,10 +272,7 @@ namespace occa {
     if (argIsUva) {
       modeMemory = (modeMemory_t*) arg;
     } else if (lookAtUva) {
-      ptrRangeMap::iterator it = uvaMap.find(arg);
-      if (it != uvaMap.end()) {
-        modeMemory = it->second;
-      }
+      modeMemory = uvaMap.find(arg);
     }
 
     if (modeMemory) {
@@ -237,6 +282,10 @@ namespace occa {
       kArg.data.void_ = arg;
       kArg.size       = bytes;
       kArg.info       = kArgInfo::usePointer;
+      // Host pointers are passed as-is, other values are read through [arg]
+      if (!lookAtUva && !argIsUva) {
+        kArg.info |= kArgInfo::pointsToValue;
+      }
       args.push_back(kArg);
     }
   }
@@ -0,0 +1,198 @@
+#include <occa/core/device.hpp>
+#include <occa/core/kernelBuild.hpp>
+#include <occa/io.hpp>
+#include <occa/tools/env.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  //---[ kernelBuildRequest ]-----------
+  kernelBuildRequest::kernelBuildRequest() {}
+
+  kernelBuildRequest::kernelBuildRequest(const std::string &filename_,
+                                         const std::string &kernelName_,
+                                         const occa::properties &props_) :
+    filename(filename_),
+    kernelName(kernelName_),
+    props(props_) {}
+  //====================================
+
+  //---[ modeKernelBuild_t ]------------
+  modeKernelBuild_t::modeKernelBuild_t() {}
+
+  modeKernelBuild_t::~modeKernelBuild_t() {}
+
+  bool modeKernelBuild_t::needsCompile() const {
+    return false;
+  }
+
+  void modeKernelBuild_t::compile() {}
+  //====================================
+
+  //---[ deferredKernelBuild_t ]--------
+  deferredKernelBuild_t::deferredKernelBuild_t(modeDevice_t *modeDevice_,
+                                               const std::string &filename_,
+                                               const std::string &kernelName_,
+                                               const hash_t kernelHash_,
+                                               const occa::properties &kernelProps_) :
+    modeDevice(modeDevice_),
+    filename(filename_),
+    kernelName(kernelName_),
+    kernelHash(kernelHash_),
+    kernelProps(kernelProps_) {}
+
+  modeKernel_t* deferredKernelBuild_t::finish() {
+    return modeDevice->buildKernel(filename,
+                                   kernelName,
+                                   kernelHash,
+                                   kernelProps);
+  }
+  //====================================
+
+  //---[ kernelBuildState_t ]-----------
+  kernelBuildState_t::kernelBuildState_t(modeDevice_t *modeDevice_,
+                                         modeKernelBuild_t *build_) :
+    modeDevice(modeDevice_),
+    build(build_),
+    setupInPool(false),
+    compiled(false),
+    finished(false) {}
+
+  kernelBuildState_t::~kernelBuildState_t() {
+    delete build;
+  }
+
+  bool kernelBuildState_t::isCompiled() {
+    if (sharedBuild) {
+      return sharedBuild->isCompiled();
+    }
+    std::unique_lock<std::mutex> guard(mutex);
+    return compiled;
+  }
+
+  void kernelBuildState_t::waitForCompile() {
+    if (sharedBuild) {
+      sharedBuild->waitForCompile();
+      return;
+    }
+    std::unique_lock<std::mutex> guard(mutex);
+    while (!compiled) {
+      compiledCondition.wait(guard);
+    }
+  }
+
+  void kernelBuildState_t::setup() {
+    occa::settings() = settings;
+
+    filename = io::findInPaths(filename, env::OCCA_KERNEL_PATH);
+    kernelHash = device::applyDependencyHash(kernelHash ^ hashFile(filename));
+    kernelProps["hash"] = kernelHash.getFullString();
+
+    build = modeDevice->startKernelBuild(filename,
+                                         kernelName,
+                                         kernelHash,
+                                         kernelProps);
+  }
+
+  void kernelBuildState_t::compile() {
+    // Errors are thrown by finish() in the thread resolving the build
+    try {
+      if (setupInPool && !build) {
+        setup();
+      }
+      if (build && build->needsCompile()) {
+        build->compile();
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+    {
+      std::unique_lock<std::mutex> guard(mutex);
+      compiled = true;
+    }
+    compiledCondition.notify_all();
+  }
+
+  occa::kernel kernelBuildState_t::finish() {
+    if (finished) {
+      return kernel;
+    }
+    waitForCompile();
+
+    if (error) {
+      delete build;
+      build = NULL;
+      modeDevice->removePendingKernelBuild(this);
+      std::rethrow_exception(error);
+    }
+
+    if (sharedBuild) {
+      // The binary is shared, load it through the cache
+      sharedBuild->finish();
+      sharedBuild.reset();
+      compile();
+      kernel = occa::device(modeDevice).buildKernel(filename,
+                                                    kernelName,
+                                                    props);
+      modeDevice->addKernelRequest(requestHash, kernel.getModeKernel());
+    } else {
+      // Pooled builds aren't shared while pending, the same kernel
+      //   could have been cached since this build started
+      modeKernel_t *cachedKernel = (
+        setupInPool
+        ? modeDevice->getCachedKernel(kernelHash, kernelName)
+        : NULL
+      );
+      modeKernel_t *modeKernel = (
+        cachedKernel
+        ? cachedKernel
+        : build->finish()
+      );
+      delete build;
+      build = NULL;
+
+      kernel = modeKernel;
+      if (cachedKernel) {
+        modeDevice->addKernelRequest(requestHash, cachedKernel);
+      } else if (modeKernel) {
+        modeKernel->hash = kernelHash;
+        modeDevice->addCachedKernel(modeKernel);
+        modeDevice->addKernelRequest(requestHash, modeKernel);
+      } else {
+        sys::rmrf(io::hashDir(filename, kernelHash));
+      }
+      modeDevice->removePendingKernelBuild(this);
+    }
+
+    finished = true;
+    return kernel;
+  }
+  //====================================
+
+  //---[ kernelFuture ]-----------------
+  kernelFuture::kernelFuture() {}
+
+  kernelFuture::kernelFuture(kernelBuildStatePtr state_) :
+    state(state_) {}
+
+  bool kernelFuture::isInitialized() const {
+    return (bool) state;
+  }
+
+  bool kernelFuture::isReady() const {
+    return (state && state->isCompiled());
+  }
+
+  void kernelFuture::wait() const {
+    if (state) {
+      state->waitForCompile();
+    }
+  }
+
+  occa::kernel kernelFuture::get() const {
+    if (!state) {
+      return occa::kernel();
+    }
+    return state->finish();
+  }
+  //====================================
+}
@@ -0,0 +1,110 @@
+#include <occa/core/device.hpp>
+#include <occa/core/launchPlan.hpp>
+
+namespace occa {
+  launchPlan::launchPlan() {}
+
+  launchPlan::launchPlan(const occa::kernel &kernel_,
+                         const kernelArg * const *args,
+                         const int count) :
+      boundKernel(kernel_) {
+    modeKernel_t *modeKernel = getLaunchKernel();
+
+    modeKernel->setArguments(args, count);
+    if (modeKernel->validatesArgTypes()) {
+      modeKernel->validateArgTypes();
+    }
+    arguments = modeKernel->arguments;
+
+    // Plans outlive the call that bound them, keep copies of values
+    //   passed by pointer (e.g. type2<TM>)
+    const int argc = (int) arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      arguments[i].ownValue();
+    }
+  }
+
+  launchPlan::launchPlan(const launchPlan &other) :
+      boundKernel(other.boundKernel),
+      arguments(other.arguments) {}
+
+  launchPlan& launchPlan::operator = (const launchPlan &other) {
+    boundKernel = other.boundKernel;
+    arguments = other.arguments;
+    return *this;
+  }
+
+  modeKernel_t* launchPlan::getLaunchKernel() const {
+    modeKernel_t *modeKernel = boundKernel.getModeKernel();
+    OCCA_ERROR("Launch plan kernel not initialized or has been freed",
+               modeKernel != NULL);
+    return modeKernel;
+  }
+
+  bool launchPlan::isInitialized() const {
+    return boundKernel.getModeKernel() != NULL;
+  }
+
+  occa::kernel launchPlan::getKernel() const {
+    return boundKernel;
+  }
+
+  int launchPlan::argumentCount() const {
+    return (int) arguments.size();
+  }
+
+  void launchPlan::setArg(const int index, const kernelArg &arg) {
+    modeKernel_t *modeKernel = getLaunchKernel();
+
+    OCCA_ERROR("(" << modeKernel->name << ") Launch plan argument index ["
+               << index << "] is out of bounds, plan has ["
+               << arguments.size() << "] arguments",
+               (0 <= index) && (index < (int) arguments.size()));
+    OCCA_ERROR("(" << modeKernel->name << ") Launch plan arguments can only be"
+               " replaced by a single value",
+               arg.size() == 1);
+
+    kernelArgData newArg = arg[0];
+    newArg.ownValue();
+    kernelArgData &oldArg = arguments[index];
+
+    // Values of the same size can't change the argument types
+    const bool isSameValueType = (
+      !newArg.modeMemory
+      && !oldArg.modeMemory
+      && (newArg.info == oldArg.info)
+      && (newArg.size == oldArg.size)
+    );
+    if (isSameValueType) {
+      oldArg = newArg;
+      return;
+    }
+
+    modeKernel->assertArgInDevice(newArg);
+    if (modeKernel->validatesArgTypes()) {
+      modeKernel->arguments = arguments;
+      modeKernel->arguments[index] = newArg;
+      modeKernel->validateArgTypes();
+    }
+    oldArg = newArg;
+  }
+
+  void launchPlan::run() const {
+    modeKernel_t *modeKernel = getLaunchKernel();
+
+    // Same size as the previous launch doesn't reallocate
+    modeKernel->arguments = arguments;
+    modeKernel->setupValidatedRun();
+
+    modeGraph_t *capturingGraph = modeKernel->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->captureKernel(*modeKernel);
+      return;
+    }
+    modeKernel->run();
+  }
+
+  void launchPlan::operator () () const {
+    run();
+  }
+}
@@ -49,7 +49,12 @@ namespace occa {
         launcherArgs.add(arg);
       }
     }
-    launcherKernel->arguments = launcherArgs.args;
+    std::vector<kernelArgData> &launcherArguments = launcherKernel->arguments;
+    launcherArguments.clear();
+    const int launcherArgCount = launcherArgs.size();
+    for (int i = 0; i < launcherArgCount; ++i) {
+      launcherArguments.push_back(launcherArgs[i]);
+    }
 
 
     int kernelCount = (int) deviceKernels.size();
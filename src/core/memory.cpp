@@ -19,19 +19,19 @@ namespace occa {
     modeDevice(modeDevice_),
     dtype_(&dtype::byte),
     size(size_),
-    isOrigin(true) {
+    isOrigin(true),
+    poolBytes(0),
+    prevStale(NULL),
+    nextStale(NULL),
+    tracksDirtyRanges(false) {
     modeDevice->addMemoryRef(this);
   }
 
   modeMemory_t::~modeMemory_t() {
-    // NULL all wrappers
-    while (memoryRing.head) {
-      memory *mem = (memory*) memoryRing.head;
-      memoryRing.removeRef(mem);
-      mem->modeMemory = NULL;
-    }
+    removeMemoryRefs();
     // Remove ref from device
     if (modeDevice) {
+      modeDevice->uvaStaleMemory.remove(this);
       modeDevice->removeMemoryRef(this);
     }
   }
@@ -52,6 +52,15 @@ namespace occa {
     memoryRing.removeRef(mem);
   }
 
+  void modeMemory_t::removeMemoryRefs() {
+    // NULL all wrappers
+    while (memoryRing.head) {
+      memory *mem = (memory*) memoryRing.head;
+      memoryRing.removeRef(mem);
+      mem->modeMemory = NULL;
+    }
+  }
+
   bool modeMemory_t::needsFree() const {
     return memoryRing.needsFree();
   }
@@ -67,6 +76,55 @@ namespace occa {
   bool modeMemory_t::isStale() const {
     return (memInfo & uvaFlag::isStale);
   }
+
+  void modeMemory_t::markHostDirty(const udim_t offset,
+                                   const udim_t bytes) {
+    if (tracksDirtyRanges) {
+      hostDirtyRanges.add(offset, bytes);
+    }
+  }
+
+  void modeMemory_t::markDeviceDirty(const udim_t offset,
+                                     const udim_t bytes) {
+    if (!tracksDirtyRanges) {
+      return;
+    }
+    deviceDirtyRanges.add(offset, bytes);
+    if (!isStale()) {
+      memInfo |= uvaFlag::isStale;
+      modeDevice->uvaStaleMemory.push(this);
+    }
+  }
+
+  void modeMemory_t::syncDirtyRangesToDevice(const udim_t offset,
+                                             const udim_t bytes) {
+    dirtyRangeSet::rangeVector ranges;
+    hostDirtyRanges.take(offset, bytes, ranges);
+
+    const int rangeCount = (int) ranges.size();
+    for (int i = 0; i < rangeCount; ++i) {
+      const dirtyRangeSet::range_t &range = ranges[i];
+      copyFrom(uvaPtr + range.first,
+               range.second - range.first,
+               range.first);
+    }
+  }
+
+  void modeMemory_t::syncDirtyRangesToHost(const udim_t offset,
+                                           const udim_t bytes,
+                                           const occa::properties &props) {
+    dirtyRangeSet::rangeVector ranges;
+    deviceDirtyRanges.take(offset, bytes, ranges);
+
+    const int rangeCount = (int) ranges.size();
+    for (int i = 0; i < rangeCount; ++i) {
+      const dirtyRangeSet::range_t &range = ranges[i];
+      copyTo(uvaPtr + range.first,
+             range.second - range.first,
+             range.first,
+             props);
+    }
+  }
   //====================================
 
 
@@ -76,9 +134,9 @@ namespace occa {
 
   memory::memory(void *uvaPtr) :
       modeMemory(NULL) {
-    ptrRangeMap::iterator it = uvaMap.find(uvaPtr);
-    if (it != uvaMap.end()) {
-      setModeMemory(it->second);
+    modeMemory_t *uvaMemory = uvaMap.find(uvaPtr);
+    if (uvaMemory) {
+      setModeMemory(uvaMemory);
     } else {
       setModeMemory((modeMemory_t*) uvaPtr);
     }
@@ -89,6 +147,25 @@ namespace occa {
     setModeMemory(modeMemory_);
   }
 
+  memory::memory(const memoryView &view) :
+    modeMemory(NULL) {
+    modeMemory_t *viewModeMemory = view.getModeMemory();
+    if (!viewModeMemory) {
+      return;
+    }
+
+    const udim_t offset = view.offset();
+    setModeMemory(viewModeMemory->addOffset(offset));
+    setDtype(view.dtype());
+
+    modeMemory->modeDevice = viewModeMemory->modeDevice;
+    modeMemory->size = view.size();
+    modeMemory->isOrigin = false;
+    if (viewModeMemory->uvaPtr) {
+      modeMemory->uvaPtr = (viewModeMemory->uvaPtr + offset);
+    }
+  }
+
   memory::memory(const memory &m) :
     modeMemory(NULL) {
     setModeMemory(m.modeMemory);
@@ -256,18 +333,23 @@ namespace occa {
       modeMemory->uvaPtr = modeMemory->ptr;
     } else {
       modeMemory->uvaPtr = (char*) sys::malloc(modeMemory->size);
+
+      // The host buffer is filled by the caller
+      if (modeMemory->properties.get("track_dirty_ranges", false)) {
+        modeMemory->tracksDirtyRanges = true;
+        modeMemory->hostDirtyRanges.add(0, modeMemory->size);
+      }
     }
 
     ptrRange range;
     range.start = modeMemory->uvaPtr;
     range.end   = (range.start + modeMemory->size);
 
-    uvaMap[range] = modeMemory;
-    modeMemory->modeDevice->uvaMap[range] = modeMemory;
+    uvaMap.insert(range, modeMemory);
 
     // Needed for kernelArg.void_ -> modeMemory checks
     if (modeMemory->uvaPtr != modeMemory->ptr) {
-      uvaMap[modeMemory->ptr] = modeMemory;
+      uvaMap.insert(modeMemory->ptr, modeMemory);
     }
   }
 
@@ -306,12 +388,18 @@ namespace occa {
       return;
     }
 
-    copyFrom(modeMemory->uvaPtr, bytes_, offset);
+    if (modeMemory->tracksDirtyRanges) {
+      modeMemory->syncDirtyRangesToDevice(offset, bytes_);
+    } else {
+      copyFrom(modeMemory->uvaPtr, bytes_, offset);
+    }
 
     modeMemory->memInfo |=  uvaFlag::inDevice;
-    modeMemory->memInfo &= ~uvaFlag::isStale;
 
-    removeFromStaleMap(modeMemory);
+    // Device writes outside of the synced range still need to be copied back
+    if (modeMemory->deviceDirtyRanges.isEmpty()) {
+      removeFromStaleMap(modeMemory);
+    }
   }
 
   void memory::syncToHost(const dim_t bytes,
@@ -337,12 +425,17 @@ namespace occa {
       return;
     }
 
-    copyTo(modeMemory->uvaPtr, bytes_, offset);
-
-    modeMemory->memInfo &= ~uvaFlag::inDevice;
-    modeMemory->memInfo &= ~uvaFlag::isStale;
+    if (modeMemory->tracksDirtyRanges) {
+      modeMemory->syncDirtyRangesToHost(offset, bytes_);
+    } else {
+      copyTo(modeMemory->uvaPtr, bytes_, offset);
+    }
 
-    removeFromStaleMap(modeMemory);
+    // Device writes outside of the synced range still need to be copied back
+    if (modeMemory->deviceDirtyRanges.isEmpty()) {
+      modeMemory->memInfo &= ~uvaFlag::inDevice;
+      removeFromStaleMap(modeMemory);
+    }
   }
 
   bool memory::uvaIsStale() const {
@@ -369,7 +462,7 @@ namespace occa {
     return (modeMemory != other.modeMemory);
   }
 
-  occa::memory memory::operator + (const dim_t offset) const {
+  occa::memoryView memory::operator + (const dim_t offset) const {
     return slice(offset);
   }
 
@@ -378,38 +471,10 @@ namespace occa {
     return *this;
   }
 
-  occa::memory memory::slice(const dim_t offset,
-                             const dim_t count) const {
+  occa::memoryView memory::slice(const dim_t offset,
+                                 const dim_t count) const {
     assertInitialized();
-
-    const int dtypeSize = modeMemory->dtype_->bytes();
-    const dim_t offset_ = dtypeSize * offset;
-    const dim_t bytes  = dtypeSize * ((count == -1)
-                                      ? (length() - offset)
-                                      : count);
-
-    OCCA_ERROR("Trying to allocate negative bytes (" << bytes << ")",
-               bytes >= 0);
-
-    OCCA_ERROR("Cannot have a negative offset (" << offset_ << ")",
-               offset_ >= 0);
-
-    OCCA_ERROR("Cannot have offset and bytes greater than the memory size ("
-               << offset_ << " + " << bytes << " > " << size() << ")",
-               (offset_ + (dim_t) bytes) <= (dim_t) size());
-
-    occa::memory m(modeMemory->addOffset(offset_));
-    m.setDtype(dtype());
-
-    modeMemory_t &mm = *(m.modeMemory);
-    mm.modeDevice = modeMemory->modeDevice;
-    mm.size = bytes;
-    mm.isOrigin = false;
-    if (modeMemory->uvaPtr) {
-      mm.uvaPtr = (modeMemory->uvaPtr + offset_);
-    }
-
-    return m;
+    return memoryView(*this).slice(offset, count);
   }
 
   void memory::copyFrom(const void *src,
@@ -430,6 +495,14 @@ namespace occa {
                << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
                (bytes_ + offset) <= modeMemory->size);
 
+    modeGraph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->captureCopy(modeMemory, NULL,
+                                  NULL, src,
+                                  bytes_, offset, 0,
+                                  props);
+      return;
+    }
     modeMemory->copyFrom(src, bytes_, offset, props);
   }
 
@@ -459,6 +532,14 @@ namespace occa {
                << " trying to access [" << destOffset << ", " << (destOffset + bytes_) << "]",
                (bytes_ + destOffset) <= modeMemory->size);
 
+    modeGraph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->captureCopy(modeMemory, NULL,
+                                  src.modeMemory, NULL,
+                                  bytes_, destOffset, srcOffset,
+                                  props);
+      return;
+    }
     modeMemory->copyFrom(src.modeMemory, bytes_, destOffset, srcOffset, props);
   }
 
@@ -480,6 +561,14 @@ namespace occa {
                << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
                (bytes_ + offset) <= modeMemory->size);
 
+    modeGraph_t *capturingGraph = modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->captureCopy(NULL, dest,
+                                  modeMemory, NULL,
+                                  bytes_, 0, offset,
+                                  props);
+      return;
+    }
     modeMemory->copyTo(dest, bytes_, offset, props);
   }
 
@@ -509,6 +598,14 @@ namespace occa {
                << " trying to access [" << destOffset << ", " << (destOffset + bytes_) << "]",
                (bytes_ + destOffset) <= dest.modeMemory->size);
 
+    modeGraph_t *capturingGraph = dest.modeMemory->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->captureCopy(dest.modeMemory, NULL,
+                                  modeMemory, NULL,
+                                  bytes_, destOffset, srcOffset,
+                                  props);
+      return;
+    }
     dest.modeMemory->copyFrom(modeMemory, bytes_, destOffset, srcOffset, props);
   }
 
@@ -571,12 +668,10 @@ namespace occa {
         void *uvaPtr = modeMemory->uvaPtr;
 
         uvaMap.erase(uvaPtr);
-        modeDevice->uvaMap.erase(uvaPtr);
 
         // CPU case where memory is shared
         if (uvaPtr != memPtr) {
           uvaMap.erase(memPtr);
-          modeDevice->uvaMap.erase(memPtr);
 
           sys::free(uvaPtr);
         }
@@ -584,6 +679,11 @@ namespace occa {
 
       if (!freeMemory) {
         modeMemory->detach();
+      } else if (modeDevice->memoryPool
+                 && modeDevice->memoryPool->release(modeMemory)) {
+        // The pool NULLs all wrappers
+        modeMemory = NULL;
+        return;
       }
     }
 
@@ -595,6 +695,161 @@ namespace occa {
   memory null;
   //====================================
 
+
+  //---[ memoryView ]-------------------
+  memoryView::memoryView() :
+    offset_(0),
+    size_(0),
+    dtype_(&dtype::byte) {}
+
+  memoryView::memoryView(const occa::memory &memory__) :
+    memory_(memory__),
+    offset_(0),
+    size_(memory__.size()),
+    dtype_(&memory__.dtype()) {}
+
+  memoryView::memoryView(const occa::memory &memory__,
+                         const udim_t offset__,
+                         const udim_t size__,
+                         const dtype_t &dtype__) :
+    memory_(memory__),
+    offset_(offset__),
+    size_(size__),
+    dtype_(&dtype__) {
+    OCCA_ERROR("Cannot have offset and bytes greater than the memory size ("
+               << offset_ << " + " << size_ << " > " << memory_.size() << ")",
+               (offset_ + size_) <= memory_.size());
+  }
+
+  bool memoryView::isInitialized() const {
+    return memory_.isInitialized();
+  }
+
+  const occa::memory& memoryView::getMemory() const {
+    return memory_;
+  }
+
+  modeMemory_t* memoryView::getModeMemory() const {
+    return memory_.getModeMemory();
+  }
+
+  occa::device memoryView::getDevice() const {
+    return memory_.getDevice();
+  }
+
+  memoryView::operator kernelArg() const {
+    modeMemory_t *modeMemory = memory_.getModeMemory();
+    if (!modeMemory) {
+      return nullKernelArg;
+    }
+    // Kernels validate the view's dtype, not the memory's
+    kernelArg arg = modeMemory->makeKernelArg(offset_);
+    const int argCount = arg.size();
+    for (int i = 0; i < argCount; ++i) {
+      arg.args[i].dtype = &(dtype_->self());
+    }
+    return arg;
+  }
+
+  const dtype_t& memoryView::dtype() const {
+    return *dtype_;
+  }
+
+  udim_t memoryView::offset() const {
+    return offset_;
+  }
+
+  udim_t memoryView::size() const {
+    return size_;
+  }
+
+  udim_t memoryView::length() const {
+    return size_ / dtype_->bytes();
+  }
+
+  bool memoryView::operator == (const occa::memoryView &other) const {
+    return ((memory_ == other.memory_)
+            && (offset_ == other.offset_)
+            && (size_ == other.size_));
+  }
+
+  bool memoryView::operator != (const occa::memoryView &other) const {
+    return !(*this == other);
+  }
+
+  occa::memoryView memoryView::operator + (const dim_t offset) const {
+    return slice(offset);
+  }
+
+  occa::memoryView& memoryView::operator += (const dim_t offset) {
+    *this = slice(offset);
+    return *this;
+  }
+
+  occa::memoryView memoryView::slice(const dim_t offset,
+                                     const dim_t count) const {
+    OCCA_ERROR("Memory not initialized or has been freed",
+               memory_.isInitialized());
+
+    const int dtypeSize = dtype_->bytes();
+    const dim_t offset_bytes = dtypeSize * offset;
+    const dim_t bytes = dtypeSize * ((count == -1)
+                                     ? ((dim_t) length() - offset)
+                                     : count);
+
+    OCCA_ERROR("Trying to allocate negative bytes (" << bytes << ")",
+               bytes >= 0);
+
+    OCCA_ERROR("Cannot have a negative offset (" << offset_bytes << ")",
+               offset_bytes >= 0);
+
+    OCCA_ERROR("Cannot have offset and bytes greater than the memory size ("
+               << offset_bytes << " + " << bytes << " > " << size_ << ")",
+               (offset_bytes + bytes) <= (dim_t) size_);
+
+    return memoryView(memory_,
+                      offset_ + offset_bytes,
+                      bytes,
+                      *dtype_);
+  }
+
+  occa::memoryView memoryView::as(const dtype_t &dtype__) const {
+    return memoryView(memory_, offset_, size_, dtype__);
+  }
+
+  void memoryView::copyFrom(const void *src,
+                            const dim_t bytes,
+                            const dim_t offset,
+                            const occa::properties &props) {
+    const dim_t bytes_ = ((bytes == -1) ? ((dim_t) size_ - offset) : bytes);
+
+    OCCA_ERROR("View has size [" << size_ << "],"
+               << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
+               (offset >= 0) && ((offset + bytes_) <= (dim_t) size_));
+
+    memory_.copyFrom(src,
+                     bytes_,
+                     offset_ + offset,
+                     props);
+  }
+
+  void memoryView::copyTo(void *dest,
+                          const dim_t bytes,
+                          const dim_t offset,
+                          const occa::properties &props) const {
+    const dim_t bytes_ = ((bytes == -1) ? ((dim_t) size_ - offset) : bytes);
+
+    OCCA_ERROR("View has size [" << size_ << "],"
+               << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
+               (offset >= 0) && ((offset + bytes_) <= (dim_t) size_));
+
+    memory_.copyTo(dest,
+                   bytes_,
+                   offset_ + offset,
+                   props);
+  }
+  //====================================
+
   std::ostream& operator << (std::ostream &out,
                              const occa::memory &memory) {
     out << memory.properties();
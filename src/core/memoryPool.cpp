@@ -0,0 +1,244 @@
+#include <occa/core/device.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/core/memoryPool.hpp>
+#include <occa/core/stream.hpp>
+#include <occa/dtype.hpp>
+#include <occa/tools/exception.hpp>
+
+namespace occa {
+  // Smallest size class is 2^minBinShift bytes
+  static const int minBinShift = 8;
+  static const int binsPerShift = 4;
+
+  static int highestBit(udim_t value) {
+    int bit = -1;
+    while (value) {
+      value >>= 1;
+      ++bit;
+    }
+    return bit;
+  }
+
+  // [capacity] is already rounded up to a size class
+  static int binIndex(const udim_t capacity) {
+    const int shift = highestBit(capacity);
+    const udim_t step = (((udim_t) 1) << shift) / binsPerShift;
+    const udim_t offset = capacity - (((udim_t) 1) << shift);
+    return (((shift - minBinShift) * binsPerShift)
+            + (int) (offset / step));
+  }
+
+  //---[ memoryPool_t ]-----------------
+  memoryPool_t::memoryPool_t(modeDevice_t *modeDevice_,
+                             const occa::properties &props) :
+    modeDevice(modeDevice_),
+    maxBinBytes(props.get<udim_t>("max_bin_bytes", 1 << 20)),
+    largeBlockBytes(props.get<udim_t>("large_block_bytes", 1 << 20)),
+    maxCachedBytes(props.get<udim_t>("max_cached_bytes", 0)),
+    bytesCached(0),
+    hits(0),
+    misses(0) {
+    OCCA_ERROR("[memory_pool/large_block_bytes] must be positive",
+               largeBlockBytes > 0);
+  }
+
+  memoryPool_t::~memoryPool_t() {
+    trim();
+  }
+
+  udim_t memoryPool_t::blockBytes(const udim_t bytes) const {
+    if (bytes > maxBinBytes) {
+      return largeBlockBytes * ((bytes + largeBlockBytes - 1) / largeBlockBytes);
+    }
+
+    const udim_t minBytes = ((udim_t) 1) << minBinShift;
+    if (bytes <= minBytes) {
+      return minBytes;
+    }
+    // Round up to the next quarter between powers of 2
+    const int shift = highestBit(bytes - 1);
+    const udim_t step = (((udim_t) 1) << shift) / binsPerShift;
+    return step * ((bytes + step - 1) / step);
+  }
+
+  modeMemory_t* memoryPool_t::malloc(const udim_t bytes,
+                                     const void *src,
+                                     const occa::properties &props) {
+    // Wrapped host pointers belong to the user
+    if (!bytes
+        || (src && props.get("use_host_pointer", false))
+        || !props.get("pool", true)) {
+      return modeDevice->malloc(bytes, src, props);
+    }
+
+    const udim_t capacity = blockBytes(bytes);
+    const hash_t propsHash = props.hash();
+    modeStream_t *modeStream = modeDevice->currentStream.getModeStream();
+
+    modeMemory_t *mem = NULL;
+    freeListMap::iterator it = freeLists.find(freeListKey(modeStream, propsHash));
+    if (it != freeLists.end()) {
+      mem = takeBlock(it->second, capacity);
+    }
+    // Fall back on blocks freed on other streams
+    if (!mem) {
+      for (it = freeLists.begin(); it != freeLists.end(); ++it) {
+        if ((it->first.first == modeStream)
+            || (it->first.second != propsHash)) {
+          continue;
+        }
+        mem = takeBlock(it->second, capacity);
+        if (mem) {
+          finishStream(it->first.first);
+          break;
+        }
+      }
+    }
+
+    if (mem) {
+      ++hits;
+      mem->properties = props;
+    } else {
+      ++misses;
+      try {
+        mem = modeDevice->malloc(capacity, NULL, props);
+      } catch (occa::exception &) {
+        // Give the cached blocks back and try again
+        if (!bytesCached) {
+          throw;
+        }
+        trim();
+        mem = modeDevice->malloc(capacity, NULL, props);
+      }
+    }
+
+    mem->size = bytes;
+    mem->poolBytes = capacity;
+    if (src) {
+      mem->copyFrom(src, bytes, 0, props);
+    }
+    return mem;
+  }
+
+  bool memoryPool_t::release(modeMemory_t *mem) {
+    // UVA allocations own a host buffer which was already freed
+    if (!mem->poolBytes
+        || mem->uvaPtr
+        || (maxCachedBytes
+            && (maxCachedBytes < (bytesCached + mem->poolBytes)))) {
+      return false;
+    }
+
+    // NULL all wrappers as if the memory was freed
+    mem->removeMemoryRefs();
+    mem->memInfo = uvaFlag::none;
+    mem->dtype_ = &dtype::byte;
+
+    modeStream_t *modeStream = modeDevice->currentStream.getModeStream();
+    addBlock(freeLists[freeListKey(modeStream, mem->properties.hash())],
+             mem);
+    bytesCached += mem->poolBytes;
+    return true;
+  }
+
+  void memoryPool_t::trim() {
+    freeListMap::iterator it = freeLists.begin();
+    while (it != freeLists.end()) {
+      freeList_t &freeList = it->second;
+
+      const int binCount = (int) freeList.bins.size();
+      for (int i = 0; i < binCount; ++i) {
+        blockVector &bin = freeList.bins[i];
+        const int blocks = (int) bin.size();
+        for (int j = 0; j < blocks; ++j) {
+          delete bin[j];
+        }
+      }
+
+      largeBlockMap::iterator blockIt = freeList.largeBlocks.begin();
+      while (blockIt != freeList.largeBlocks.end()) {
+        delete blockIt->second;
+        ++blockIt;
+      }
+      ++it;
+    }
+    freeLists.clear();
+    bytesCached = 0;
+  }
+
+  void memoryPool_t::removeStream(modeStream_t *modeStream) {
+    freeListMap::iterator it = freeLists.begin();
+    while (it != freeLists.end()) {
+      if (it->first.first != modeStream) {
+        ++it;
+        continue;
+      }
+      freeList_t &streamFreeList = it->second;
+      freeList_t &freeList = freeLists[freeListKey(NULL, it->first.second)];
+
+      const int binCount = (int) streamFreeList.bins.size();
+      for (int i = 0; i < binCount; ++i) {
+        blockVector &bin = streamFreeList.bins[i];
+        const int blocks = (int) bin.size();
+        for (int j = 0; j < blocks; ++j) {
+          addBlock(freeList, bin[j]);
+        }
+      }
+      freeList.largeBlocks.insert(streamFreeList.largeBlocks.begin(),
+                                  streamFreeList.largeBlocks.end());
+
+      freeLists.erase(it++);
+    }
+  }
+
+  modeMemory_t* memoryPool_t::takeBlock(freeList_t &freeList,
+                                        const udim_t capacity) {
+    modeMemory_t *mem = NULL;
+    if (capacity <= maxBinBytes) {
+      const int bin = binIndex(capacity);
+      if ((bin < (int) freeList.bins.size())
+          && freeList.bins[bin].size()) {
+        mem = freeList.bins[bin].back();
+        freeList.bins[bin].pop_back();
+      }
+    } else {
+      largeBlockMap::iterator it = freeList.largeBlocks.lower_bound(capacity);
+      if ((it != freeList.largeBlocks.end())
+          && (it->first <= (capacity + (capacity / 4)))) {
+        mem = it->second;
+        freeList.largeBlocks.erase(it);
+      }
+    }
+    if (mem) {
+      bytesCached -= mem->poolBytes;
+    }
+    return mem;
+  }
+
+  void memoryPool_t::addBlock(freeList_t &freeList,
+                              modeMemory_t *mem) {
+    if (mem->poolBytes <= maxBinBytes) {
+      const int bin = binIndex(mem->poolBytes);
+      if ((int) freeList.bins.size() <= bin) {
+        freeList.bins.resize(bin + 1);
+      }
+      freeList.bins[bin].push_back(mem);
+    } else {
+      freeList.largeBlocks.insert(
+        largeBlockMap::value_type(mem->poolBytes, mem)
+      );
+    }
+  }
+
+  void memoryPool_t::finishStream(modeStream_t *modeStream) {
+    // Blocks without a stream were freed after their work finished
+    if (!modeStream) {
+      return;
+    }
+    stream currentStream = modeDevice->currentStream;
+    modeDevice->currentStream = stream(modeStream);
+    modeDevice->finish();
+    modeDevice->currentStream = currentStream;
+  }
+  //====================================
+}
@@ -79,7 +79,7 @@ namespace occa {
         std::stringstream ss;
         ss << header << '\n'
            << io::read(expFilename);
-        io::write(sourceFile, ss.str());
+        io::atomicWrite(sourceFile, ss.str());
       }
 
       return sourceFile;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <errno.h>
 #include <sys/stat.h>
@@ -10,31 +11,68 @@
 #include <occa/tools/env.hpp>
 
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <sys/file.h>
 #  include <unistd.h>
+#  if (OCCA_OS == OCCA_LINUX_OS)
+#    include <sys/inotify.h>
+#  endif
 #else
 #  include <windows.h> // Sleep
 #endif
 
 namespace occa {
   namespace io {
+    // Results from waitForFileLock()
+    static const int lockWasReleased = 0;
+    static const int lockIsMine      = 1;
+    static const int lockWasReplaced = 2;
+
     lock_t::lock_t() :
       isMineCached(false),
-      released(true) {}
+      released(true),
+      backend(lockBackend::dir),
+      usingInotify(false),
+      fd(-1) {}
 
     lock_t::lock_t(const hash_t &hash,
                    const std::string &tag,
                    const float staleAge_) :
       isMineCached(false),
       staleAge(staleAge_),
-      released(false) {
+      released(false),
+      backend(lockBackend::dir),
+      usingInotify(false),
+      fd(-1) {
+
+      occa::json &lockSettings = settings()["locks"];
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      const std::string backendName = lockSettings.get("backend",
+                                                       std::string("flock"));
+      if (backendName == "flock") {
+        backend = lockBackend::flock;
+      } else {
+        OCCA_ERROR("Unknown lock backend [" << backendName << "],"
+                   << " expected [flock] or [dir]",
+                   backendName == "dir");
+      }
+#endif
+#if (OCCA_OS == OCCA_LINUX_OS)
+      usingInotify = lockSettings.get("inotify", true);
+#endif
 
       lockDir = env::OCCA_CACHE_DIR;
       lockDir += "locks/";
       lockDir += hash.getString();
       lockDir += '_';
       lockDir += tag;
+      // Avoid clashing with lock directories from processes using the dir backend
+      if (backend == lockBackend::flock) {
+        lockDir += ".lock";
+      }
 
-      occa::json &lockSettings = settings()["locks"];
       staleWarning = lockSettings.get("stale_warning",
                                       (float) 10.0);
       if (staleAge <= 0) {
@@ -55,11 +93,25 @@ namespace occa {
       return lockDir;
     }
 
+    int lock_t::getBackend() const {
+      return backend;
+    }
+
     void lock_t::release() const {
-      if (!released) {
+      if (released) {
+        return;
+      }
+      if (backend == lockBackend::flock) {
+        // Only remove the lock file if we hold it, it might have been
+        //   released and recreated by another process
+        if (holdsLockFile()) {
+          ::unlink(lockDir.c_str());
+        }
+        closeLockFile();
+      } else {
         sys::rmdir(lockDir);
-        released = true;
       }
+      released = true;
     }
 
     bool lock_t::isMine() {
@@ -68,6 +120,10 @@ namespace occa {
       }
       sys::mkpath(env::OCCA_CACHE_DIR + "locks/");
 
+      if (backend == lockBackend::flock) {
+        return fileLockIsMine();
+      }
+
       while (true) {
         int mkdirStatus = sys::mkdir(lockDir);
 
@@ -123,5 +179,144 @@ namespace occa {
 
       return false;
     }
+
+    //---[ flock Backend ]--------------
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    bool lock_t::fileLockIsMine() {
+      while (true) {
+        // Compiler processes forked while the lock is held shouldn't
+        //   inherit the fd, flock locks live until every copy is closed
+        fd = ::open(lockDir.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        OCCA_ERROR("Unable to open lock file [" << lockDir << "]",
+                   fd >= 0);
+
+        int status;
+        if (!::flock(fd, LOCK_EX | LOCK_NB)) {
+          // The file could have been released between open() and flock()
+          status = holdsLockFile() ? lockIsMine : lockWasReplaced;
+        } else {
+          status = waitForFileLock();
+        }
+
+        if (status == lockIsMine) {
+          isMineCached = true;
+          return true;
+        }
+
+        closeLockFile();
+        if (status == lockWasReleased) {
+          released = true;
+          return false;
+        }
+        // Try again with a new lock file
+      }
+    }
+
+    int lock_t::waitForFileLock() {
+      const double startTime = sys::currentTime();
+
+      // Wake up when the holder removes or closes the lock file
+      int inotifyFd = -1;
+#if (OCCA_OS == OCCA_LINUX_OS)
+      if (usingInotify) {
+        inotifyFd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if ((inotifyFd >= 0)
+            && (::inotify_add_watch(inotifyFd,
+                                    lockDir.c_str(),
+                                    IN_ATTRIB | IN_CLOSE_WRITE
+                                    | IN_DELETE_SELF | IN_MOVE_SELF) < 0)) {
+          ::close(inotifyFd);
+          inotifyFd = -1;
+        }
+      }
+#endif
+
+      int sleepMicroseconds = 1000;
+      int status;
+      while (true) {
+        if (!::flock(fd, LOCK_EX | LOCK_NB)) {
+          // A released lock file is unlinked before being unlocked,
+          //   a lock left behind by a process that died is still linked
+          // If a new lock file replaced ours, wait on that one instead
+          struct stat pathInfo;
+          if (holdsLockFile()) {
+            status = lockIsMine;
+          } else if (!::stat(lockDir.c_str(), &pathInfo)) {
+            status = lockWasReplaced;
+          } else {
+            status = lockWasReleased;
+          }
+          break;
+        }
+
+        // The kernel drops the flock when the holder dies, so a held
+        //   lock is never stale no matter how long the build takes
+        // Print warning only once
+        if ((sys::currentTime() - startTime) > staleWarning) {
+          io::stderr << "Located possible stale hash: ["
+                     << lockDir
+                     << "]\n";
+          staleWarning = staleAge + 10;
+        }
+
+        if (inotifyFd >= 0) {
+          // Timeout in case the release isn't reported
+          struct pollfd pollInfo;
+          pollInfo.fd = inotifyFd;
+          pollInfo.events = POLLIN;
+          if (::poll(&pollInfo, 1, 250) > 0) {
+            char events[4096];
+            while (::read(inotifyFd, events, sizeof(events)) > 0) {}
+          }
+        } else {
+          ::usleep(sleepMicroseconds);
+          sleepMicroseconds = std::min(2 * sleepMicroseconds, 100000);
+        }
+      }
+
+      if (inotifyFd >= 0) {
+        ::close(inotifyFd);
+      }
+      return status;
+    }
+
+    bool lock_t::holdsLockFile() const {
+      if (fd < 0) {
+        return false;
+      }
+      struct stat fdInfo, pathInfo;
+      if (::fstat(fd, &fdInfo)
+          || ::stat(lockDir.c_str(), &pathInfo)) {
+        return false;
+      }
+      return (
+        (fdInfo.st_nlink > 0)
+        && (fdInfo.st_dev == pathInfo.st_dev)
+        && (fdInfo.st_ino == pathInfo.st_ino)
+      );
+    }
+
+    void lock_t::closeLockFile() const {
+      if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+      }
+    }
+#else
+    bool lock_t::fileLockIsMine() {
+      return true;
+    }
+
+    int lock_t::waitForFileLock() {
+      return lockIsMine;
+    }
+
+    bool lock_t::holdsLockFile() const {
+      return false;
+    }
+
+    void lock_t::closeLockFile() const {}
+#endif
+    //==================================
   }
 }
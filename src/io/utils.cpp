@@ -1,3 +1,6 @@
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -20,6 +23,7 @@
 #include <occa/io/fileOpener.hpp>
 #include <occa/io/utils.hpp>
 #include <occa/tools/env.hpp>
+#include <occa/tools/hash.hpp>
 #include <occa/tools/lex.hpp>
 #include <occa/tools/misc.hpp>
 
@@ -32,6 +36,8 @@ namespace occa {
     const std::string launcherSourceFile = "launcher_source.cpp";
     const std::string buildFile          = "build.json";
     const std::string launcherBuildFile  = "launcher_build.json";
+    const std::string jitBinaryFile      = "jit_binary.o";
+    const std::string preludeFile        = "prelude.hpp";
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
     const std::string binaryFile         = "binary";
     const std::string launcherBinaryFile = "launcher_binary";
@@ -53,7 +59,8 @@ namespace occa {
     const std::string& cachePath() {
       static std::string path;
       if (path.size() == 0) {
-        path = env::OCCA_CACHE_DIR + "cache/";
+        // Hash directories are only valid for the hash that made them
+        path = env::OCCA_CACHE_DIR + "cache/v" + toString(OCCA_HASH_VERSION) + "/";
       }
       return path;
     }
@@ -393,10 +400,29 @@ namespace occa {
       OCCA_ERROR("Failed to open [" << io::shortname(expFilename) << "]",
                  fp != 0);
 
-      fputs(content.c_str(), fp);
+      // fwrite instead of fputs so binary content isn't truncated at a NUL
+      fwrite(content.c_str(), sizeof(char), content.size(), fp);
 
       fsync(fileno(fp));
       fclose(fp);
     }
+
+    void atomicWrite(const std::string &filename,
+                     const std::string &content) {
+      const std::string expFilename = io::filename(filename);
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      const std::string tempFilename = expFilename + ".tmp" + toString(::getpid());
+#else
+      const std::string tempFilename = expFilename + ".tmp" + toString(GetCurrentProcessId());
+#endif
+      write(tempFilename, content);
+      if (::rename(tempFilename.c_str(), expFilename.c_str())) {
+        const int error = errno;
+        ::remove(tempFilename.c_str());
+        OCCA_FORCE_ERROR("Failed to move [" << io::shortname(tempFilename) << "]"
+                         << " to [" << io::shortname(expFilename) << "]: "
+                         << ::strerror(error));
+      }
+    }
   }
 }
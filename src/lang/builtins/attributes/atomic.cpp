@@ -34,7 +34,8 @@ namespace occa {
       bool atomic::applyCodeTransformation(
         blockStatement &root,
         blockSmntBoolCallback transformBlockSmnt,
-        exprSmntBoolCallback transformBasicExprSmnt
+        exprSmntBoolCallback transformBasicExprSmnt,
+        exprSmntBoolCallback isBasicExprSmnt
       ) {
         bool success = true;
         statementArray::from(root)
@@ -48,14 +49,16 @@ namespace occa {
                   success &= applyExpressionCodeTransformation(
                     exprSmnt,
                     transformBlockSmnt,
-                    transformBasicExprSmnt
+                    transformBasicExprSmnt,
+                    isBasicExprSmnt
                   );
                 } else {
                   blockStatement &blockSmnt = (blockStatement&) *smnt;
                   success &= applyBlockCodeTransformation(
                     blockSmnt,
                     transformBlockSmnt,
-                    transformBasicExprSmnt
+                    transformBasicExprSmnt,
+                    isBasicExprSmnt
                   );
                 }
               });
@@ -65,11 +68,12 @@ namespace occa {
       bool atomic::applyExpressionCodeTransformation(
         expressionStatement &exprSmnt,
         blockSmntBoolCallback transformBlockSmnt,
-        exprSmntBoolCallback transformBasicExprSmnt
+        exprSmntBoolCallback transformBasicExprSmnt,
+        exprSmntBoolCallback isBasicExprSmnt
       ) {
         blockStatement &parent = *(exprSmnt.up);
 
-        if (attributes::atomic::isBasicExpression(exprSmnt)) {
+        if (isBasicExprSmnt(exprSmnt)) {
           return transformBasicExprSmnt(exprSmnt);
         }
 
@@ -86,22 +90,42 @@ namespace occa {
       bool atomic::applyBlockCodeTransformation(
         blockStatement &blockSmnt,
         blockSmntBoolCallback transformBlockSmnt,
-        exprSmntBoolCallback transformBasicExprSmnt
+        exprSmntBoolCallback transformBasicExprSmnt,
+        exprSmntBoolCallback isBasicExprSmnt
       ) {
-        if (blockSmnt.size() == 1
-            && (blockSmnt[0]->type() & statementType::expression)) {
+        const int childCount = blockSmnt.size();
+        bool hasOnlyBasicExpressions = (childCount > 0);
+        for (int i = 0; i < childCount; ++i) {
+          statement_t &smnt = *blockSmnt[i];
+          if (!(smnt.type() & statementType::expression)
+              || !isBasicExprSmnt((expressionStatement&) smnt)) {
+            hasOnlyBasicExpressions = false;
+            break;
+          }
+        }
+
+        if (!hasOnlyBasicExpressions) {
+          return transformBlockSmnt(blockSmnt);
+        }
+
+        if (childCount == 1) {
+          // Remove unneeded block statement
           expressionStatement &exprSmnt = (expressionStatement&) *blockSmnt[0];
-          if (attributes::atomic::isBasicExpression(exprSmnt)) {
-            // Remove unneeded block statement
-            blockSmnt.remove(exprSmnt);
-            blockSmnt.replaceWith(exprSmnt);
-            delete &blockSmnt;
+          blockSmnt.remove(exprSmnt);
+          blockSmnt.replaceWith(exprSmnt);
+          delete &blockSmnt;
 
-            return transformBasicExprSmnt(exprSmnt);
-          }
+          return transformBasicExprSmnt(exprSmnt);
         }
 
-        return transformBlockSmnt(blockSmnt);
+        // Each update is made atomic on its own
+        // Copy the children since transformations can add statements
+        statementArray children = blockSmnt.children;
+        bool success = true;
+        for (int i = 0; i < childCount; ++i) {
+          success &= transformBasicExprSmnt((expressionStatement&) *children[i]);
+        }
+        return success;
       }
 
       bool atomic::isBasicExpression(expressionStatement &exprSmnt) {
@@ -19,8 +19,7 @@ namespace occa {
       }
 
       bool outer::isValid(const attributeToken_t &attr) const {
-        if (attr.kwargs.size()) {
-          attr.printError("[@outer] does not take kwargs");
+        if (!validKwargs(attr)) {
           return false;
         }
         const int argCount = (int) attr.args.size();
@@ -46,6 +45,44 @@ namespace occa {
         }
         return true;
       }
+
+      bool outer::validKwargs(const attributeToken_t &attr) const {
+        // Host-mode scheduling hints, ignored by other backends:
+        //   @outer(schedule="dynamic, 4", collapse=2, proc_bind="close", num_threads=8)
+        attributeArgMap::const_iterator it = attr.kwargs.begin();
+        while (it != attr.kwargs.end()) {
+          const std::string &kwarg = it->first;
+          exprNode *value = it->second.expr;
+
+          if ((kwarg == "schedule")
+              || (kwarg == "proc_bind")) {
+            if (!value || (value->type() != exprNodeType::string)) {
+              attr.printError("[@outer] expects a string for [" + kwarg + "]");
+              return false;
+            }
+          } else if (kwarg == "collapse") {
+            bool error = (!value || !value->canEvaluate());
+            if (!error) {
+              primitive collapse = value->evaluate();
+              error = (!collapse.isInteger() || ((int) collapse < 1));
+            }
+            if (error) {
+              attr.printError("[@outer] expects a positive integer for [collapse]");
+              return false;
+            }
+          } else if (kwarg == "num_threads") {
+            if (!value) {
+              attr.printError("[@outer] expects a value for [num_threads]");
+              return false;
+            }
+          } else {
+            attr.printError("[@outer] does not take the kwarg [" + kwarg + "]");
+            return false;
+          }
+          ++it;
+        }
+        return true;
+      }
     }
   }
 }
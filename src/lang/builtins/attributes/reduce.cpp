@@ -0,0 +1,183 @@
+#include <algorithm>
+
+#include <occa/lang/expr.hpp>
+#include <occa/lang/parser.hpp>
+#include <occa/lang/statement.hpp>
+#include <occa/lang/variable.hpp>
+#include <occa/lang/builtins/attributes/reduce.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace attributes {
+      reduce::reduce() {}
+
+      const std::string& reduce::name() const {
+        static std::string name_ = "reduce";
+        return name_;
+      }
+
+      bool reduce::forStatementType(const int sType) const {
+        return (sType & statementType::for_);
+      }
+
+      bool reduce::isValid(const attributeToken_t &attr) const {
+        if (attr.kwargs.size()) {
+          attr.printError("[@reduce] does not take kwargs");
+          return false;
+        }
+
+        const int argCount = (int) attr.args.size();
+        if (argCount < 2) {
+          attr.printError("[@reduce] expects an operator and the variables to reduce,"
+                          " for example: @reduce(\"+\", sum)");
+          return false;
+        }
+
+        exprNode *opExpr = attr.args[0].expr;
+        if (!opExpr
+            || (opExpr->type() != exprNodeType::string)
+            || !isValidOperator(((stringNode*) opExpr)->value)) {
+          attr.printError("[@reduce] operator must be one of"
+                          " \"+\", \"*\", \"&\", \"|\", \"^\", \"&&\", \"||\", \"min\" or \"max\"");
+          return false;
+        }
+
+        for (int i = 1; i < argCount; ++i) {
+          exprNode *varExpr = attr.args[i].expr;
+          if (!varExpr
+              || (varExpr->type() != exprNodeType::variable)) {
+            attr.printError("[@reduce] expects variables after the operator");
+            return false;
+          }
+        }
+        return true;
+      }
+
+      bool reduce::isValidOperator(const std::string &op) {
+        return (
+          (op == "+")
+          || (op == "*")
+          || (op == "&")
+          || (op == "|")
+          || (op == "^")
+          || (op == "&&")
+          || (op == "||")
+          || (op == "min")
+          || (op == "max")
+        );
+      }
+
+      std::string reduce::getOperator(const attributeToken_t &attr) {
+        return ((stringNode*) attr.args[0].expr)->value;
+      }
+
+      void reduce::getVariables(const attributeToken_t &attr,
+                                std::vector<variable_t*> &vars) {
+        const int argCount = (int) attr.args.size();
+        for (int i = 1; i < argCount; ++i) {
+          vars.push_back(
+            &(((variableNode*) attr.args[i].expr)->value)
+          );
+        }
+      }
+
+      bool reduce::supportsAllOperators(const std::string &op) {
+        return true;
+      }
+
+      variable_t* reduce::getUpdatedVariable(exprNode *expr) {
+        if (!expr) {
+          return NULL;
+        }
+
+        // Find the assigned value in updates such as
+        //   sum += x, sum[0] = x, ++(*sum)
+        exprNode *value = NULL;
+        const udim_t exprType = expr->type();
+        if (exprType & exprNodeType::binary) {
+          binaryOpNode &opNode = (binaryOpNode&) *expr;
+          if (opNode.opType() & operatorType::assignment) {
+            value = opNode.leftValue;
+          }
+        } else if (exprType & exprNodeType::leftUnary) {
+          leftUnaryOpNode &opNode = (leftUnaryOpNode&) *expr;
+          if (opNode.opType() & (operatorType::increment |
+                                 operatorType::decrement)) {
+            value = opNode.value;
+          }
+        } else if (exprType & exprNodeType::rightUnary) {
+          rightUnaryOpNode &opNode = (rightUnaryOpNode&) *expr;
+          if (opNode.opType() & (operatorType::increment |
+                                 operatorType::decrement)) {
+            value = opNode.value;
+          }
+        }
+
+        while (value) {
+          const udim_t valueType = value->type();
+          if (valueType & exprNodeType::variable) {
+            return &(((variableNode*) value)->value);
+          }
+          if (valueType & exprNodeType::parentheses) {
+            value = ((parenthesesNode*) value)->value;
+          } else if (valueType & exprNodeType::subscript) {
+            value = ((subscriptNode*) value)->value;
+          } else if ((valueType & exprNodeType::leftUnary)
+                     && (((leftUnaryOpNode*) value)->opType() & operatorType::dereference)) {
+            value = ((leftUnaryOpNode*) value)->value;
+          } else {
+            break;
+          }
+        }
+        return NULL;
+      }
+
+      bool reduce::applyAtomicTransformations(blockStatement &root,
+                                              const attribute_t &atomicAttribute,
+                                              reduceOperatorCallback isSupportedOperator) {
+        bool success = true;
+        statementArray::from(root)
+            .flatFilterByStatementType(statementType::for_, "reduce")
+            .forEach([&](statement_t *smnt) {
+                attributeToken_t &reduceAttr = smnt->attributes["reduce"];
+
+                const std::string op = getOperator(reduceAttr);
+                if (!isSupportedOperator(op)) {
+                  reduceAttr.printError("[@reduce] operator [" + op + "] is not supported"
+                                        " in this mode");
+                  success = false;
+                  return;
+                }
+
+                std::vector<variable_t*> vars;
+                getVariables(reduceAttr, vars);
+
+                statementArray::from(*smnt)
+                    .flatFilterByStatementType(statementType::expression)
+                    .forEach([&](statement_t *exprSmnt) {
+                        if (exprSmnt->hasAttribute("atomic")) {
+                          return;
+                        }
+
+                        // Skip statements already inside an @atomic block
+                        for (statement_t *up = exprSmnt->up; up != smnt; up = up->up) {
+                          if (up->hasAttribute("atomic")) {
+                            return;
+                          }
+                        }
+
+                        // Only updates race, reading the reduced value doesn't
+                        variable_t *var = getUpdatedVariable(
+                          ((expressionStatement*) exprSmnt)->expr
+                        );
+                        if (std::find(vars.begin(), vars.end(), var) != vars.end()) {
+                          exprSmnt->attributes["atomic"] = attributeToken_t(atomicAttribute,
+                                                                            *reduceAttr.source);
+                        }
+                      });
+              });
+        return success;
+      }
+    }
+  }
+}
@@ -60,6 +60,16 @@ namespace occa {
         return name;
       }
 
+      bool cudaParser::supportsReduceOperator(const std::string &op) {
+        // Updates are lowered to atomicAdd, atomicAnd, atomicOr and atomicXor
+        return (
+          (op == "+")
+          || (op == "&")
+          || (op == "|")
+          || (op == "^")
+        );
+      }
+
       void cudaParser::updateConstToConstant() {
         root.children
             .forEachDeclaration([&](variableDeclaration &decl) {
@@ -139,7 +149,8 @@ namespace occa {
         success &= attributes::atomic::applyCodeTransformation(
           root,
           transformBlockStatement,
-          transformBasicExpressionStatement
+          transformBasicExpressionStatement,
+          isBasicExpression
         );
       }
 
@@ -180,6 +191,9 @@ namespace occa {
           // Cases:
           //   @atomic i += 1;
           //   @atomic i -= 1;
+          //   @atomic i &= 1;
+          //   @atomic i |= 1;
+          //   @atomic i ^= 1;
           binaryOpNode &binaryNode = (binaryOpNode&) *exprSmnt.expr;
           expr variable = binaryNode.leftValue;
           expr value = binaryNode.rightValue;
@@ -187,6 +201,12 @@ namespace occa {
             pout << "atomicAdd(&" << expr::parens(variable) << ", " << value << ");";
           } else if (opType & operatorType::subEq) {
             pout << "atomicSub(&" << expr::parens(variable) << ", " << value << ");";
+          } else if (opType & operatorType::andEq) {
+            pout << "atomicAnd(&" << expr::parens(variable) << ", " << value << ");";
+          } else if (opType & operatorType::orEq) {
+            pout << "atomicOr(&" << expr::parens(variable) << ", " << value << ");";
+          } else if (opType & operatorType::xorEq) {
+            pout << "atomicXor(&" << expr::parens(variable) << ", " << value << ");";
           } else {
             exprSmnt.printError("Unable to transform @atomic code");
             return false;
@@ -206,6 +226,19 @@ namespace occa {
 
         return true;
       }
+
+      bool cudaParser::isBasicExpression(expressionStatement &exprSmnt) {
+        const opType_t &opType = expr(exprSmnt.expr).opType();
+        return opType & (
+          operatorType::addEq
+          | operatorType::subEq
+          | operatorType::andEq
+          | operatorType::orEq
+          | operatorType::xorEq
+          | operatorType::increment
+          | operatorType::decrement
+        );
+      }
     }
   }
 }
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 
 #include <occa/lang/modes/okl.hpp>
@@ -36,6 +37,7 @@ namespace occa {
           && kernelHasValidOklLoops(kernelSmnt)
           && kernelHasValidSharedAndExclusiveDeclarations(kernelSmnt)
           && kernelHasValidLoopBreakAndContinue(kernelSmnt)
+          && kernelHasValidReductions(kernelSmnt)
         );
       }
 
@@ -343,6 +345,42 @@ namespace occa {
         );
       }
 
+      bool kernelHasValidReductions(functionDeclStatement &kernelSmnt) {
+        return (
+          statementArray::from(kernelSmnt)
+          .flatFilterByStatementType(statementType::for_, "reduce")
+          .filter([&](statement_t *smnt) {
+              attributeToken_t &reduceAttr = smnt->attributes["reduce"];
+
+              // @reduce is only supported on @outer loops
+              if (!smnt->hasAttribute("outer")) {
+                reduceAttr.printError("[@reduce] can only be used on [@outer] loops");
+                return true;
+              }
+
+              // Reduced values need to outlive the loop
+              std::vector<variable_t*> vars;
+              attributes::reduce::getVariables(reduceAttr, vars);
+
+              bool hasLoopVariable = false;
+              statementArray::from(*smnt)
+                  .flatFilterByStatementType(statementType::declaration)
+                  .forEach([&](statement_t *declSmnt) {
+                      for (auto &decl : ((declarationStatement*) declSmnt)->declarations) {
+                        variable_t *var = &(decl.variable());
+                        if (std::find(vars.begin(), vars.end(), var) != vars.end()) {
+                          reduceAttr.printError("[@reduce] variable [" + var->name() + "]"
+                                                " must be declared outside of the loop");
+                          hasLoopVariable = true;
+                        }
+                      }
+                    });
+              return hasLoopVariable;
+            })
+          .isEmpty()
+        );
+      }
+
       //---[ Helper Methods ]-----------
       bool isOklForLoop(statement_t *smnt) {
         std::string oklAttr;
@@ -389,6 +427,7 @@ namespace occa {
         parser.addAttribute<attributes::inner>();
         parser.addAttribute<attributes::kernel>();
         parser.addAttribute<attributes::outer>();
+        parser.addAttribute<attributes::reduce>();
         parser.addAttribute<attributes::shared>();
       }
 
@@ -264,21 +264,30 @@ namespace occa {
           return NULL;
         }
 
+        // Positive updates: check - init
+        // Negative updates: init - check
         exprNode *initInParen = initValue->wrapInParentheses();
+        exprNode *checkInParen = checkValue->wrapInParentheses();
         exprNode *count = (
-          new binaryOpNode(iterator->source,
-                           positiveUpdate ? op::sub : op::add,
-                           *checkValue,
-                           *initInParen)
+          positiveUpdate
+          ? new binaryOpNode(iterator->source,
+                             op::sub,
+                             *checkValue,
+                             *initInParen)
+          : new binaryOpNode(iterator->source,
+                             op::sub,
+                             *initInParen,
+                             *checkInParen)
         );
         delete initInParen;
+        delete checkInParen;
 
         if (checkIsInclusive) {
           primitiveNode inc(iterator->source, 1);
 
           exprNode *countWithInc = (
             new binaryOpNode(iterator->source,
-                             positiveUpdate ? op::sub : op::add,
+                             op::add,
                              *count,
                              inc)
           );
@@ -287,15 +296,16 @@ namespace occa {
         }
 
         if (updateValue) {
+          // (count + update - 1) / update
           exprNode *updateInParen = updateValue->wrapInParentheses();
 
           primitiveNode one(iterator->source, 1);
           binaryOpNode boundCheck(iterator->source,
-                                  positiveUpdate ? op::add : op::sub,
+                                  op::add,
                                   *count,
                                   *updateInParen);
           binaryOpNode boundCheck2(iterator->source,
-                                   positiveUpdate ? op::sub : op::add,
+                                   op::sub,
                                    boundCheck,
                                    one);
           exprNode *boundCheckInParen = boundCheck2.wrapInParentheses();
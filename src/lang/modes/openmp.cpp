@@ -1,25 +1,45 @@
+#include <algorithm>
+
+#include <occa/tools/string.hpp>
+#include <occa/tools/vector.hpp>
 #include <occa/lang/modes/openmp.hpp>
-#include <occa/lang/expr/expr.hpp>
+#include <occa/lang/modes/oklForStatement.hpp>
+#include <occa/lang/expr.hpp>
 #include <occa/lang/builtins/attributes/atomic.hpp>
+#include <occa/lang/builtins/attributes/reduce.hpp>
 
 namespace occa {
   namespace lang {
     namespace okl {
       openmpParser::openmpParser(const occa::properties &settings_) :
-        serialParser(settings_) {}
+        serialParser(settings_),
+        atomicBlockCount(0) {}
+
+      void openmpParser::onClear() {
+        serialParser::onClear();
+        atomicBlockCount = 0;
+      }
 
       void openmpParser::afterParsing() {
         serialParser::afterParsing();
 
         if (!success) return;
-        setupOmpPragmas();
+        if (settings.get<std::string>("parallel_for", "omp") == "thread_pool") {
+          // The thread pool has no reductions, update reduced variables atomically
+          success &= attributes::reduce::applyAtomicTransformations(root,
+                                                                    *getAttribute("atomic"));
+          if (!success) return;
+          setupThreadPoolLoops();
+        } else {
+          setupOmpPragmas();
+        }
 
         if (!success) return;
         setupAtomics();
       }
 
-      void openmpParser::setupOmpPragmas() {
-        statementArray outerSmnts = (
+      statementArray openmpParser::getOuterMostOuterLoops() {
+        return (
           statementArray::from(root)
           .flatFilter([&](statement_t *smnt, const statementArray &path) {
               // Needs to be a @outer for-loop
@@ -37,6 +57,10 @@ namespace occa {
               return true;
             })
         );
+      }
+
+      void openmpParser::setupOmpPragmas() {
+        statementArray outerSmnts = getOuterMostOuterLoops();
 
         const int count = (int) outerSmnts.length();
         for (int i = 0; i < count; ++i) {
@@ -54,13 +78,263 @@ namespace occa {
           pragmaStatement *pragmaSmnt = (
             new pragmaStatement((blockStatement*) parent,
                                 pragmaToken(outerBlock.source->origin,
-                                            "omp parallel for"))
+                                            getOmpPragma((forStatement&) outerSmnt)))
           );
           parentBlock.addBefore(outerSmnt,
                                 *pragmaSmnt);
         }
       }
 
+      std::string openmpParser::getOmpPragma(forStatement &forSmnt) {
+        // Kernel props set the defaults, @outer kwargs override them
+        std::string schedule = settings.get<std::string>("omp/schedule", "");
+        std::string procBind = settings.get<std::string>("omp/proc_bind", "");
+        std::string numThreads;
+        if (settings.has("omp/num_threads")) {
+          numThreads = occa::toString((int) settings["omp/num_threads"]);
+        }
+
+        attributeArgMap &kwargs = forSmnt.attributes["outer"].kwargs;
+        attributeArgMap::iterator it = kwargs.find("schedule");
+        if (it != kwargs.end()) {
+          schedule = ((stringNode*) it->second.expr)->value;
+        }
+        it = kwargs.find("proc_bind");
+        if (it != kwargs.end()) {
+          procBind = ((stringNode*) it->second.expr)->value;
+        }
+        it = kwargs.find("num_threads");
+        if (it != kwargs.end()) {
+          numThreads = it->second.expr->toString();
+        }
+
+        std::vector<forStatement*> loops;
+        getCollapsedOuterLoops(forSmnt,
+                               getCollapse(forSmnt, "omp/collapse"),
+                               loops);
+        const int collapse = (int) loops.size();
+
+        std::string pragma = "omp parallel for";
+        if (schedule.size()) {
+          pragma += " schedule(" + schedule + ")";
+        }
+        if (collapse > 1) {
+          pragma += " collapse(" + occa::toString(collapse) + ")";
+        }
+        if (procBind.size()) {
+          pragma += " proc_bind(" + procBind + ")";
+        }
+        if (numThreads.size()) {
+          pragma += " num_threads(" + numThreads + ")";
+        }
+
+        // Any @reduce inside the parallel region is reduced by this pragma
+        statementArray::from(forSmnt)
+            .flatFilterByStatementType(statementType::for_, "reduce")
+            .forEach([&](statement_t *smnt) {
+                attributeToken_t &reduceAttr = smnt->attributes["reduce"];
+
+                std::vector<variable_t*> vars;
+                attributes::reduce::getVariables(reduceAttr, vars);
+
+                // Pointers reduce into their first entry
+                strVector names;
+                for (auto var : vars) {
+                  names.push_back(
+                    var->vartype.isPointerType()
+                    ? var->name() + "[0:1]"
+                    : var->name()
+                  );
+                }
+                pragma += (
+                  " reduction(" + attributes::reduce::getOperator(reduceAttr)
+                  + ": " + join(names, ", ") + ")"
+                );
+              });
+        return pragma;
+      }
+
+      int openmpParser::getCollapse(forStatement &forSmnt,
+                                    const std::string &collapseSetting) {
+        attributeArgMap &kwargs = forSmnt.attributes["outer"].kwargs;
+        attributeArgMap::iterator it = kwargs.find("collapse");
+        if (it != kwargs.end()) {
+          return (int) it->second.expr->evaluate();
+        }
+        return std::max(1, settings.get(collapseSetting, 1));
+      }
+
+      void openmpParser::getCollapsedOuterLoops(forStatement &forSmnt,
+                                                const int collapse,
+                                                std::vector<forStatement*> &loops) {
+        // Only perfectly nested @outer loops can be collapsed
+        loops.push_back(&forSmnt);
+        while ((int) loops.size() < collapse) {
+          forStatement &lastLoop = *(loops.back());
+          if ((lastLoop.children.length() != 1)
+              || !isOuterForLoop(lastLoop.children[0])) {
+            break;
+          }
+          loops.push_back((forStatement*) lastLoop.children[0]);
+        }
+      }
+
+      void openmpParser::setupThreadPoolLoops() {
+        statementArray outerSmnts = getOuterMostOuterLoops();
+
+        const int count = (int) outerSmnts.length();
+        if (!count) {
+          return;
+        }
+
+        // Don't rely on serial/include_std or the prelude for occa::parallelFor
+        directiveToken token(root.source->origin,
+                             "include <occa/tools/workStealingPool.hpp>");
+        root.addFirst(
+          *(new directiveStatement(&root, token))
+        );
+
+        for (int i = 0; i < count; ++i) {
+          setupThreadPoolLoop(*((forStatement*) outerSmnts[i]));
+          if (!success) return;
+        }
+      }
+
+      void openmpParser::setupThreadPoolLoop(forStatement &forSmnt) {
+        // Merge perfectly nested @outer loops into one iteration space:
+        //   for (i; @outer) { for (j; @outer) { body } }
+        // becomes
+        //   {
+        //     const occa::dim_t _occa_outer_count_0 = <i-count>;
+        //     const occa::dim_t _occa_outer_count_1 = <j-count>;
+        //     auto _occa_outer_body = [&](const occa::dim_t _occa_outer_index) {
+        //       <i, j from _occa_outer_index>
+        //       body
+        //     };
+        //     occa::parallelFor(<count>, <chunk>, ...);
+        //   }
+        const int chunkSize = settings.get("thread_pool/chunk_size", 0);
+
+        std::vector<forStatement*> loops;
+        getCollapsedOuterLoops(forSmnt,
+                               getCollapse(forSmnt, "thread_pool/collapse"),
+                               loops);
+
+        const int loopCount = (int) loops.size();
+        std::vector<std::string> counts;
+        std::vector<declarationStatement*> iteratorDecls;
+        for (int i = 0; i < loopCount; ++i) {
+          forStatement &loop = *(loops[i]);
+          oklForStatement oklForSmnt(loop);
+          if (!oklForSmnt.isValid()) {
+            success = false;
+            return;
+          }
+
+          exprNode *countExpr = oklForSmnt.getIterationCount();
+          counts.push_back(countExpr->toString());
+          delete countExpr;
+
+          const std::string indexName = "_occa_outer_index_" + occa::toString(i);
+          identifierToken indexSource(oklForSmnt.iterator->source->origin,
+                                      indexName);
+          identifierNode index(&indexSource,
+                               indexName);
+
+          declarationStatement &declSmnt = (
+            *(new declarationStatement(NULL, loop.source))
+          );
+          declSmnt.declarations.push_back(
+            variableDeclaration(*oklForSmnt.iterator,
+                                oklForSmnt.makeDeclarationValue(index))
+          );
+          iteratorDecls.push_back(&declSmnt);
+        }
+
+        forStatement &innerMostLoop = *(loops.back());
+
+        // Create block in case there are duplicate variable names
+        blockStatement &launchBlock = (
+          *new blockStatement(forSmnt.up, forSmnt.source)
+        );
+        forSmnt.replaceWith(launchBlock);
+
+        std::string iterations;
+        for (int i = 0; i < loopCount; ++i) {
+          const std::string countName = "_occa_outer_count_" + occa::toString(i);
+          launchBlock.add(
+            *new sourceCodeStatement(&launchBlock, forSmnt.source,
+                                     "const occa::dim_t " + countName + " = " + counts[i] + ";")
+          );
+          if (i) {
+            iterations += " * ";
+          }
+          iterations += countName;
+        }
+
+        launchBlock.add(
+          *new sourceCodeStatement(&launchBlock, forSmnt.source,
+                                   "auto _occa_outer_body = [&](const occa::dim_t _occa_outer_index)")
+        );
+
+        blockStatement &bodyBlock = (
+          *new blockStatement(&launchBlock, innerMostLoop.source)
+        );
+        bodyBlock.swap(innerMostLoop);
+        launchBlock.add(bodyBlock);
+
+        // Add iterator declarations in reverse order
+        for (int i = loopCount - 1; i >= 0; --i) {
+          bodyBlock.addFirst(*(iteratorDecls[i]));
+        }
+
+        // Split the merged index, last loop varies the fastest
+        std::string indexSource;
+        for (int i = loopCount - 1; i >= 0; --i) {
+          const std::string indexName = "_occa_outer_index_" + occa::toString(i);
+          const std::string countName = "_occa_outer_count_" + occa::toString(i);
+          if (loopCount == 1) {
+            indexSource = "const occa::dim_t " + indexName + " = _occa_outer_index;";
+          } else if (i == (loopCount - 1)) {
+            indexSource = (
+              "occa::dim_t _occa_outer_rest = _occa_outer_index;\n"
+              "const occa::dim_t " + indexName + " = _occa_outer_rest % " + countName + ";"
+            );
+          } else if (i) {
+            indexSource += (
+              "\n_occa_outer_rest /= _occa_outer_count_" + occa::toString(i + 1) + ";\n"
+              "const occa::dim_t " + indexName + " = _occa_outer_rest % " + countName + ";"
+            );
+          } else {
+            indexSource += (
+              "\nconst occa::dim_t " + indexName + " = _occa_outer_rest / _occa_outer_count_1;"
+            );
+          }
+        }
+        bodyBlock.addFirst(
+          *new sourceCodeStatement(&bodyBlock, forSmnt.source, indexSource)
+        );
+
+        launchBlock.add(
+          *new sourceCodeStatement(&launchBlock, forSmnt.source, ";")
+        );
+        launchBlock.add(
+          *new sourceCodeStatement(
+            &launchBlock, forSmnt.source,
+            "occa::parallelFor(" + iterations + ",\n"
+            "                  " + occa::toString(chunkSize) + ",\n"
+            "                  occa::parallelForChunk<decltype(_occa_outer_body)>,\n"
+            "                  &_occa_outer_body);"
+          )
+        );
+
+        // The iterators of the merged @outer loops are declared in the body now
+        for (int i = 0; i < (loopCount - 1); ++i) {
+          loops[i]->scope.moveTo(bodyBlock.scope);
+        }
+        delete &forSmnt;
+      }
+
       bool openmpParser::isOuterForLoop(statement_t *smnt) {
         return (
           (smnt->type() & statementType::for_)
@@ -71,18 +345,34 @@ namespace occa {
       void openmpParser::setupAtomics() {
         success &= attributes::atomic::applyCodeTransformation(
           root,
-          transformBlockStatement,
-          transformBasicExpressionStatement
+          [&](blockStatement &blockSmnt) {
+            return transformBlockStatement(blockSmnt);
+          },
+          transformBasicExpressionStatement,
+          isBasicExpression
         );
       }
 
       bool openmpParser::transformBlockStatement(blockStatement &blockSmnt) {
         blockStatement &parent = *(blockSmnt.up);
 
+        // An unnamed critical section is one global lock shared with
+        //   every other @atomic block, name it after the kernel instead
+        std::string name = "_occa_atomic_";
+        statement_t *kernelSmnt = blockSmnt.up;
+        while (kernelSmnt
+               && !(kernelSmnt->type() & statementType::functionDecl)) {
+          kernelSmnt = kernelSmnt->up;
+        }
+        if (kernelSmnt) {
+          name += ((functionDeclStatement*) kernelSmnt)->function().name() + "_";
+        }
+        name += occa::toString(atomicBlockCount++);
+
         pragmaStatement &atomicPragmaSmnt = *(
           new pragmaStatement(&parent,
                               pragmaToken(blockSmnt.source->origin,
-                                          "omp critical"))
+                                          "omp critical(" + name + ")"))
         );
 
         parent.addBefore(blockSmnt, atomicPragmaSmnt);
@@ -103,6 +393,23 @@ namespace occa {
 
         return true;
       }
+
+      bool openmpParser::isBasicExpression(expressionStatement &exprSmnt) {
+        const opType_t &opType = expr(exprSmnt.expr).opType();
+        return opType & (
+          operatorType::addEq
+          | operatorType::subEq
+          | operatorType::multEq
+          | operatorType::divEq
+          | operatorType::andEq
+          | operatorType::orEq
+          | operatorType::xorEq
+          | operatorType::leftShiftEq
+          | operatorType::rightShiftEq
+          | operatorType::increment
+          | operatorType::decrement
+        );
+      }
     }
   }
 }
@@ -1,7 +1,10 @@
 #include <set>
 
+#include <occa/tools/string.hpp>
+#include <occa/tools/vector.hpp>
 #include <occa/lang/modes/serial.hpp>
 #include <occa/lang/modes/okl.hpp>
+#include <occa/lang/modes/oklForStatement.hpp>
 #include <occa/lang/builtins/types.hpp>
 #include <occa/lang/expr.hpp>
 
@@ -9,6 +12,7 @@ namespace occa {
   namespace lang {
     namespace okl {
       const std::string serialParser::exclusiveIndexName = "_occa_exclusive_index";
+      const std::string serialParser::trampolinePrefix = "_occa_trampoline_";
 
       serialParser::serialParser(const occa::properties &settings_) :
         parser_t(settings_) {
@@ -29,13 +33,27 @@ namespace occa {
 
         if (!success) return;
         setupExclusives();
+
+        if (!success) return;
+        setupSimdPragmas();
+
+        if (!success) return;
+        if (settings.get("serial/trampolines", false)) {
+          setupTrampolines();
+        }
       }
 
       void serialParser::setupHeaders() {
         strVector headers;
         const bool includingStd = settings.get("serial/include_std", true);
-        headers.push_back("include <occa.hpp>\n");
-        if (includingStd) {
+        // The prelude has the same includes and might be precompiled
+        const std::string prelude = settings.get("serial/prelude", std::string());
+        if (prelude.size()) {
+          headers.push_back("include \"" + prelude + "\"\n");
+        } else {
+          headers.push_back("include <occa.hpp>\n");
+        }
+        if (includingStd && !prelude.size()) {
           headers.push_back("include <stdint.h>");
           headers.push_back("include <cstdlib>");
           headers.push_back("include <cstdio>");
@@ -301,6 +319,162 @@ namespace occa {
                                  expr,
                                  indexVarNode);
       }
+
+      void serialParser::setupSimdPragmas() {
+        if (!settings.get("simd/enabled", true)) {
+          return;
+        }
+
+        statementArray::from(root)
+            .flatFilterByStatementType(statementType::for_, "inner")
+            .forEach([&](statement_t *smnt) {
+                forStatement &forSmnt = (forStatement&) *smnt;
+                statement_t *parent = forSmnt.up;
+                if (!parent
+                    || !parent->is<blockStatement>()
+                    || !canVectorize(forSmnt)) {
+                  return;
+                }
+
+                pragmaStatement &simdPragmaSmnt = *(
+                  new pragmaStatement((blockStatement*) parent,
+                                      pragmaToken(forSmnt.source->origin,
+                                                  getSimdPragma(forSmnt)))
+                );
+                ((blockStatement*) parent)->addBefore(forSmnt, simdPragmaSmnt);
+              });
+      }
+
+      bool serialParser::canVectorize(forStatement &forSmnt) {
+        statementArray loopSmnts = statementArray::from(forSmnt);
+
+        // Only the inner-most @inner loop is vectorized
+        if (loopSmnts.flatFilterByStatementType(statementType::for_, "inner").length() > 1) {
+          return false;
+        }
+
+        // @inner iterations are independent, the loop just needs to be
+        // in canonical form
+        oklForStatement oklForSmnt(forSmnt, "", false);
+        if (!oklForSmnt.isValid()) {
+          return false;
+        }
+
+        // The exclusive index is incremented every iteration
+        if (forSmnt.hasInScope(exclusiveIndexName)) {
+          return false;
+        }
+
+        // Reduced variables are updated every iteration
+        for (statement_t *up = forSmnt.up; up; up = up->up) {
+          if (up->hasAttribute("reduce")) {
+            return false;
+          }
+        }
+
+        // Atomics and early exits are not allowed inside simd loops
+        if (loopSmnts.flatFilterByAttribute("atomic").length()) {
+          return false;
+        }
+        const int exitTypes = (
+          statementType::break_
+          | statementType::return_
+          | statementType::goto_
+        );
+        if (loopSmnts.flatFilterByStatementType(exitTypes).length()) {
+          return false;
+        }
+
+        return true;
+      }
+
+      std::string serialParser::getSimdPragma(forStatement &forSmnt) {
+        std::string pragma = "omp simd";
+
+        const int safelen = settings.get("simd/safelen", 0);
+        if (safelen > 0) {
+          pragma += " safelen(" + occa::toString(safelen) + ")";
+        }
+
+        // Only @restrict kernel arguments are assumed to point to
+        // the start of an allocation
+        const int alignment = settings.get("simd/aligned", 0);
+        if (alignment <= 0) {
+          return pragma;
+        }
+
+        statement_t *kernelSmnt = forSmnt.up;
+        while (kernelSmnt
+               && !(kernelSmnt->type() & statementType::functionDecl)) {
+          kernelSmnt = kernelSmnt->up;
+        }
+        if (!kernelSmnt) {
+          return pragma;
+        }
+
+        function_t &func = ((functionDeclStatement*) kernelSmnt)->function();
+        std::set<variable_t*> restrictArgs;
+        for (auto arg : func.args) {
+          if (arg
+              && arg->hasAttribute("restrict")
+              && arg->vartype.isPointerType()) {
+            restrictArgs.insert(arg);
+          }
+        }
+
+        strVector alignedArgs;
+        statementArray::from(forSmnt)
+            .flatFilterByExprType(exprNodeType::variable)
+            .forEach([&](smntExprNode smntExpr) {
+                variable_t &var = ((variableNode*) smntExpr.node)->value;
+                const std::string &name = var.name();
+                if (restrictArgs.count(&var)
+                    && (indexOf(alignedArgs, name) < 0)) {
+                  alignedArgs.push_back(name);
+                }
+              });
+
+        if (alignedArgs.size()) {
+          pragma += (
+            " aligned(" + join(alignedArgs, ", ")
+            + ": " + occa::toString(alignment) + ")"
+          );
+        }
+        return pragma;
+      }
+
+      void serialParser::setupTrampolines() {
+        // Calls the kernel directly with its own signature:
+        //   extern "C" void _occa_trampoline_foo(void **args) {
+        //     occa::serial::callKernel(::foo, args);
+        //   }
+        // The kernel name is qualified since [using namespace std] could
+        //   bring in overloads with the same name (e.g. std::distance)
+        std::string source = "#include <occa/modes/serial/trampoline.hpp>\n";
+        int kernelCount = 0;
+
+        root.children.forEachKernelStatement([&](functionDeclStatement &kernelSmnt) {
+            const std::string &kernelName = kernelSmnt.function().name();
+            source += "\nextern \"C\" ";
+#if OCCA_OS == OCCA_WINDOWS_OS
+            source += "__declspec(dllexport) ";
+#endif
+            source += (
+              "void " + trampolinePrefix + kernelName + "(void **args) {\n"
+              "  occa::serial::callKernel(::" + kernelName + ", args);\n"
+              "}\n"
+            );
+            ++kernelCount;
+          });
+
+        if (!kernelCount) {
+          return;
+        }
+
+        root.addLast(
+          *(new sourceCodeStatement(&root, root.source, source))
+        );
+      }
     }
   }
 }
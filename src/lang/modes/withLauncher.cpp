@@ -38,6 +38,16 @@ namespace occa {
           success = kernelsAreValid(root);
         }
 
+        // @reduce loops are split across blocks, update reduced variables atomically
+        if (!success) return;
+        success &= attributes::reduce::applyAtomicTransformations(
+          root,
+          *getAttribute("atomic"),
+          [&](const std::string &op) {
+            return supportsReduceOperator(op);
+          }
+        );
+
         if (!success) return;
         setOklLoopIndices();
 
@@ -552,6 +562,10 @@ namespace occa {
       bool withLauncher::usesBarriers() {
         return true;
       }
+
+      bool withLauncher::supportsReduceOperator(const std::string &op) {
+        return false;
+      }
     }
   }
 }
@@ -32,13 +32,19 @@ namespace occa {
       return ((device*) modeDevice)->getCuStream();
     }
 
-    kernelArg memory::makeKernelArg() const {
+    kernelArg memory::makeKernelArg(const udim_t offset) const {
       kernelArgData arg;
 
       arg.modeMemory = const_cast<memory*>(this);
-      arg.data.void_ = (void*) &cuPtr;
       arg.size       = sizeof(void*);
-      arg.info       = kArgInfo::usePointer;
+      if (!offset) {
+        arg.data.void_ = (void*) &cuPtr;
+        arg.info       = kArgInfo::usePointer;
+      } else {
+        // Pass the offset pointer by value
+        arg.data.uint64_ = (uint64_t) (cuPtr + offset);
+        arg.info         = kArgInfo::none;
+      }
 
       return kernelArg(arg);
     }
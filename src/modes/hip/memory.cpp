@@ -37,11 +37,11 @@ namespace occa {
       return ((device*) modeDevice)->getHipStream();
     }
 
-    kernelArg memory::makeKernelArg() const {
+    kernelArg memory::makeKernelArg(const udim_t offset) const {
       kernelArgData arg;
 
       arg.modeMemory = const_cast<memory*>(this);
-      arg.data.void_ = (void*) hipPtr;
+      arg.data.void_ = (void*) addHipPtrOffset(hipPtr, offset);
       arg.size       = sizeof(void*);
       arg.info       = kArgInfo::usePointer;
 
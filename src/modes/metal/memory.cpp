@@ -17,13 +17,14 @@ namespace occa {
       size = 0;
     }
 
-    kernelArg memory::makeKernelArg() const {
+    kernelArg memory::makeKernelArg(const udim_t offset) const {
       kernelArgData arg;
 
-      arg.modeMemory = const_cast<memory*>(this);
-      arg.data.void_ = (void*) NULL;
-      arg.size       = sizeof(void*);
-      arg.info       = kArgInfo::usePointer;
+      // The offset is added to the buffer offset when setting the argument
+      arg.modeMemory   = const_cast<memory*>(this);
+      arg.data.uint64_ = offset;
+      arg.size         = sizeof(void*);
+      arg.info         = kArgInfo::usePointer;
 
       return kernelArg(arg);
     }
@@ -31,6 +31,16 @@ namespace occa {
                           clReleaseMemObject(clMem));
       }
 
+      offsetClMemMap::iterator it = offsetClMems.begin();
+      while (it != offsetClMems.end()) {
+        if (it->second) {
+          OCCA_OPENCL_ERROR("Mapped Free: clReleaseMemObject",
+                            clReleaseMemObject(it->second));
+        }
+        ++it;
+      }
+      offsetClMems.clear();
+
       rootClMem = NULL;
       rootOffset = 0;
 
@@ -43,17 +53,43 @@ namespace occa {
       return ((device*) modeDevice)->getCommandQueue();
     }
 
-    kernelArg memory::makeKernelArg() const {
+    kernelArg memory::makeKernelArg(const udim_t offset) const {
       kernelArgData arg;
 
       arg.modeMemory = const_cast<memory*>(this);
-      arg.data.void_ = (void*) &clMem;
+      arg.data.void_ = (void*) (offset
+                                ? &getOffsetClMem(offset)
+                                : &clMem);
       arg.size       = sizeof(void*);
       arg.info       = kArgInfo::usePointer;
 
       return kernelArg(arg);
     }
 
+    cl_mem& memory::getOffsetClMem(const udim_t offset) const {
+      // cl_mem handles can't be offset, sub-buffers are created once
+      //   and reused by later kernel arguments with the same range
+      const udim_t bytes = size - offset;
+      cl_mem &offsetClMem = offsetClMems[offsetClMemKey(offset, bytes)];
+      if (offsetClMem) {
+        return offsetClMem;
+      }
+
+      cl_buffer_region info;
+      info.origin = rootOffset + offset;
+      info.size   = bytes;
+
+      cl_int error;
+      offsetClMem = clCreateSubBuffer(*rootClMem,
+                                      CL_MEM_READ_WRITE,
+                                      CL_BUFFER_CREATE_TYPE_REGION,
+                                      &info,
+                                      &error);
+
+      OCCA_OPENCL_ERROR("Device: clCreateSubBuffer", error);
+      return offsetClMem;
+    }
+
     modeMemory_t* memory::addOffset(const dim_t offset) {
       opencl::memory *m = new opencl::memory(modeDevice,
                                              size - offset,
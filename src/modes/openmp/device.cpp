@@ -7,15 +7,32 @@
 namespace occa {
   namespace openmp {
     device::device(const occa::properties &properties_) :
-      serial::device(properties_) {}
+      serial::device(properties_) {
+      // Spread large copies and new allocations across the host threads
+      //   instead of placing every page on the allocating thread's node
+      occa::json &memoryProps = properties["memory"];
+      if (!memoryProps.has("parallel_copies")) {
+        memoryProps["parallel_copies"] = true;
+      }
+      if (!memoryProps.has("first_touch")) {
+        memoryProps["first_touch"] = true;
+      }
+    }
 
     hash_t device::kernelHash(const occa::properties &props) const {
       return (
         serial::device::kernelHash(props)
         ^ occa::hash("openmp")
+        ^ props["omp"]
+        ^ props["parallel_for"]
+        ^ props["thread_pool"]
       );
     }
 
+    bool device::supportsInProcessJit() const {
+      return false;
+    }
+
     bool device::parseFile(const std::string &filename,
                            const std::string &outputFile,
                            const occa::properties &kernelProps,
@@ -44,12 +61,9 @@ namespace occa {
       return true;
     }
 
-    modeKernel_t* device::buildKernel(const std::string &filename,
-                                      const std::string &kernelName,
-                                      const hash_t kernelHash,
-                                      const occa::properties &kernelProps) {
-
-      occa::properties allKernelProps = properties + kernelProps;
+    bool device::setupKernelProps(const occa::properties &kernelProps,
+                                  occa::properties &allKernelProps) {
+      allKernelProps = properties + kernelProps;
 
       std::string compiler = allKernelProps["compiler"];
       int vendor = allKernelProps["vendor"];
@@ -58,6 +72,7 @@ namespace occa {
         vendor = sys::compilerVendor(compiler);
       }
 
+      std::lock_guard<std::mutex> guard(lastCompilerMutex);
       if (compiler != lastCompiler) {
         lastCompiler = compiler;
         lastCompilerOpenMPFlag = openmp::compilerFlag(vendor, compiler);
@@ -72,6 +87,28 @@ namespace occa {
       if (usingOpenMP) {
         allKernelProps["compiler_flags"] += " " + lastCompilerOpenMPFlag;
       }
+      return usingOpenMP;
+    }
+
+    modeKernelBuild_t* device::startKernelBuild(const std::string &filename,
+                                                const std::string &kernelName,
+                                                const hash_t kernelHash,
+                                                const occa::properties &kernelProps) {
+      occa::properties allKernelProps;
+      setupKernelProps(kernelProps, allKernelProps);
+
+      return serial::device::startKernelBuild(filename,
+                                              kernelName,
+                                              kernelHash,
+                                              allKernelProps);
+    }
+
+    modeKernel_t* device::buildKernel(const std::string &filename,
+                                      const std::string &kernelName,
+                                      const hash_t kernelHash,
+                                      const occa::properties &kernelProps) {
+      occa::properties allKernelProps;
+      const bool usingOpenMP = setupKernelProps(kernelProps, allKernelProps);
 
       modeKernel_t *k = serial::device::buildKernel(filename,
                                                     kernelName,
@@ -1,18 +1,26 @@
+#include <algorithm>
+#include <memory>
+
 #include <occa/core/base.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/io.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/graph.hpp>
+#include <occa/modes/serial/jit.hpp>
 #include <occa/modes/serial/kernel.hpp>
+#include <occa/modes/serial/kernelBuild.hpp>
 #include <occa/modes/serial/memory.hpp>
 #include <occa/modes/serial/stream.hpp>
+#include <occa/tools/hostCopy.hpp>
 #include <occa/modes/serial/streamTag.hpp>
 #include <occa/lang/modes/serial.hpp>
 
 namespace occa {
   namespace serial {
     device::device(const occa::properties &properties_) :
-      occa::modeDevice_t(properties_) {
+      occa::modeDevice_t(properties_),
+      asyncStreams(0) {
 
       occa::json &kernelProps = properties["kernel"];
       std::string compiler;
@@ -70,6 +78,9 @@ namespace occa {
       } else {
         sys::addCompilerFlags(compilerFlags, sys::compilerC99Flags(compilerVendor));
       }
+      if (kernelProps.get("simd/enabled", true)) {
+        sys::addCompilerFlags(compilerFlags, sys::compilerOpenMPSimdFlags(compilerVendor));
+      }
 
       if (env::var("OCCA_COMPILER_SHARED_FLAGS").size()) {
         compilerSharedFlags = env::var("OCCA_COMPILER_SHARED_FLAGS");
@@ -129,7 +140,12 @@ namespace occa {
 
     device::~device() {}
 
-    void device::finish() const {}
+    void device::finish() const {
+      stream *modeStream = getCurrentStream();
+      if (modeStream) {
+        modeStream->finish();
+      }
+    }
 
     bool device::hasSeparateMemorySpace() const {
       return false;
@@ -151,6 +167,8 @@ namespace occa {
         ^ props["compiler_language"]
         ^ props["compiler_linker_flags"]
         ^ props["compiler_shared_flags"]
+        ^ props["simd"]
+        ^ props["pch"]
       );
     }
 
@@ -160,10 +178,26 @@ namespace occa {
     }
 
     occa::streamTag device::tagStream() {
-      return new occa::serial::streamTag(this, sys::currentTime());
+      stream *modeStream = getCurrentStream();
+      if (!modeStream || !modeStream->isAsync()) {
+        return new occa::serial::streamTag(this, sys::currentTime());
+      }
+
+      occa::serial::streamTag *tag = new occa::serial::streamTag(this);
+      modeStream->enqueue(
+        std::bind(&occa::serial::streamTag::record, tag)
+      );
+      return tag;
     }
 
-    void device::waitFor(occa::streamTag tag) {}
+    void device::waitFor(occa::streamTag tag) {
+      occa::serial::streamTag *srTag = (
+        dynamic_cast<occa::serial::streamTag*>(tag.getModeStreamTag())
+      );
+      if (srTag) {
+        srTag->wait();
+      }
+    }
 
     double device::timeBetween(const occa::streamTag &startTag,
                                const occa::streamTag &endTag) {
@@ -174,8 +208,42 @@ namespace occa {
         dynamic_cast<occa::serial::streamTag*>(endTag.getModeStreamTag())
       );
 
+      srStartTag->wait();
+      srEndTag->wait();
+
       return (srEndTag->time - srStartTag->time);
     }
+
+    stream* device::getCurrentStream() const {
+      return (stream*) currentStream.getModeStream();
+    }
+
+    void device::addAsyncStream() {
+      ++asyncStreams;
+    }
+
+    void device::removeAsyncStream() {
+      --asyncStreams;
+    }
+
+    bool device::hasAsyncStreams() const {
+      return asyncStreams;
+    }
+
+    void device::finishAllStreams() const {
+      if (!asyncStreams || !streamRing.head) {
+        return;
+      }
+      gc::ringEntry_t *entry = streamRing.head;
+      do {
+        ((stream*) (modeStream_t*) entry)->finish();
+        entry = entry->rightRingEntry;
+      } while (entry != streamRing.head);
+    }
+
+    modeGraph_t* device::createGraph(const occa::properties &props) {
+      return new graph(this, props);
+    }
     //==================================
 
     //---[ Kernel ]---------------------
@@ -219,18 +287,156 @@ namespace occa {
       return buildKernel(filename, kernelName, kernelHash, properties["kernel"], true);
     }
 
+    modeKernelBuild_t* device::startKernelBuild(const std::string &filename,
+                                                const std::string &kernelName,
+                                                const hash_t kernelHash,
+                                                const occa::properties &kernelProps) {
+      std::unique_ptr<kernelBuild> build(new kernelBuild(this));
+      setupKernelBuild(*build, filename, kernelName, kernelHash, kernelProps, false);
+      return build.release();
+    }
+
     modeKernel_t* device::buildKernel(const std::string &filename,
                                       const std::string &kernelName,
                                       const hash_t kernelHash,
                                       const occa::properties &kernelProps,
                                       const bool isLauncherKernel) {
+      kernelBuild build(this);
+      setupKernelBuild(build, filename, kernelName, kernelHash, kernelProps, isLauncherKernel);
+      build.compile();
+      return build.finish();
+    }
+
+    std::string device::getKernelPrelude(const occa::properties &kernelProps,
+                                         const std::string &compiler,
+                                         const std::string &compilerFlags,
+                                         const std::string &compilerEnvScript,
+                                         std::string &pchFlags) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      const int vendor = kernelProps.get("compiler_vendor", (int) sys::vendor::notFound);
+
+      // GCC picks up [prelude.hpp.gch] by itself, clang needs -include-pch
+      std::string pchFile;
+      if (vendor & sys::vendor::GNU) {
+        pchFile = kc::preludeFile + ".gch";
+      } else if (vendor & sys::vendor::LLVM) {
+        pchFile = kc::preludeFile + ".pch";
+      } else {
+        return "";
+      }
+
+      const bool includingStd = kernelProps.get("serial/include_std", true);
+      const hash_t preludeHash = (
+        occa::hash("prelude")
+        ^ occa::hash(compiler)
+        ^ occa::hash(compilerFlags)
+        ^ occa::hash(compilerEnvScript)
+        ^ occa::hash(OCCA_VERSION_STR)
+        ^ occa::hash(env::OCCA_DIR)
+        ^ occa::hash(env::OCCA_INSTALL_DIR)
+        ^ occa::hash(includingStd ? "std" : "")
+      );
+
+      const std::string hashDir = io::hashDir(preludeHash);
+      const std::string preludeFilename = hashDir + kc::preludeFile;
+      const std::string pchFilename = hashDir + pchFile;
+      const std::string buildLogFile = "build.log";
+
+      // Only try building the precompiled header once
+      if (!io::cachedFileIsComplete(hashDir, buildLogFile)) {
+        io::lock_t lock(preludeHash, "serial-prelude");
+        if (lock.isMine()) {
+          std::stringstream ss;
+          ss << "#ifndef OCCA_KERNEL_PRELUDE_HEADER\n"
+             << "#define OCCA_KERNEL_PRELUDE_HEADER\n\n";
+          if (includingStd) {
+            ss << "#include <cmath>\n"
+               << "#include <cstdio>\n"
+               << "#include <cstdlib>\n"
+               << "#include <stdint.h>\n";
+          }
+          ss << "#include <occa.hpp>\n\n"
+             << "#endif\n";
+          io::write(preludeFilename, ss.str());
+          io::markCachedFileComplete(hashDir, kc::preludeFile);
+
+          std::stringstream command;
+          if (compilerEnvScript.size()) {
+            command << compilerEnvScript << " && ";
+          }
+          command << compiler
+                  << ' '    << compilerFlags
+                  << " -x c++-header " << preludeFilename
+                  << " -o " << pchFilename
+                  << " -I"  << env::OCCA_DIR << "include"
+                  << " -I"  << env::OCCA_INSTALL_DIR << "include"
+                  << " > "  << hashDir << buildLogFile << " 2>&1";
+
+          const std::string pchCommand = command.str();
+          if (kernelProps.get("verbose", false)) {
+            io::stdout << "Precompiling kernel headers\n" << pchCommand << "\n";
+          }
+
+          // Kernels still compile with the plain header if this fails
+          if (!system(pchCommand.c_str()) && io::isFile(pchFilename)) {
+            io::markCachedFileComplete(hashDir, pchFile);
+          }
+          io::markCachedFileComplete(hashDir, buildLogFile);
+        }
+      }
+
+      if (!io::cachedFileIsComplete(hashDir, kc::preludeFile)) {
+        return "";
+      }
+      if ((vendor & sys::vendor::LLVM)
+          && io::cachedFileIsComplete(hashDir, pchFile)) {
+        pchFlags = " -include-pch " + pchFilename;
+      }
+      return preludeFilename;
+#else
+      return "";
+#endif
+    }
+
+    bool device::supportsInProcessJit() const {
+      return true;
+    }
+
+    void device::setupKernelBuild(kernelBuild &build,
+                                  const std::string &filename,
+                                  const std::string &kernelName,
+                                  const hash_t kernelHash,
+                                  const occa::properties &kernelProps,
+                                  const bool isLauncherKernel) {
       const std::string hashDir = io::hashDir(filename, kernelHash);
 
-      const std::string &kcBinaryFile = (
+      const std::string &sharedKcBinaryFile = (
         isLauncherKernel
         ? kc::launcherBinaryFile
         : kc::binaryFile
       );
+      const std::string sharedBinaryFilename = hashDir + sharedKcBinaryFile;
+
+      const bool compilingCpp = (
+        ((int) kernelProps["compiler_language"]) == sys::language::CPP
+      );
+      std::string compilerEnvScript = kernelProps["compiler_env_script"];
+
+      // The JIT object is cached next to the shared library
+      bool usingJit = (
+        kernelProps.get("jit/enabled", false)
+        && !isLauncherKernel
+        && compilingCpp
+        && !compilerEnvScript.size()
+        && supportsInProcessJit()
+        && jit::isAvailable()
+      );
+
+      std::string kcBinaryFile = (
+        usingJit
+        ? kc::jitBinaryFile
+        : sharedKcBinaryFile
+      );
       std::string binaryFilename = hashDir + kcBinaryFile;
 
       // Check if binary exists and is finished
@@ -239,12 +445,32 @@ namespace occa {
         && io::isFile(binaryFilename)
       );
 
-      io::lock_t lock;
       if (!foundBinary) {
-        lock = io::lock_t(kernelHash, "serial-kernel");
-        foundBinary = !lock.isMine();
+        build.lock = io::lock_t(kernelHash, "serial-kernel");
+        foundBinary = !build.lock.isMine();
+      }
+
+      // Use the shared library if a previous in-process compile fell back to it
+      if (usingJit
+          && !io::cachedFileIsComplete(hashDir, kcBinaryFile)
+          && io::cachedFileIsComplete(hashDir, sharedKcBinaryFile)) {
+        if (build.lock.isMine()) {
+          build.lock.release();
+        }
+        foundBinary = true;
+        usingJit = false;
+        kcBinaryFile = sharedKcBinaryFile;
+        binaryFilename = sharedBinaryFilename;
       }
 
+      build.filename = filename;
+      build.kernelName = kernelName;
+      build.hashDir = hashDir;
+      build.kcBinaryFile = kcBinaryFile;
+      build.binaryFilename = binaryFilename;
+      build.sharedBinaryFilename = sharedBinaryFilename;
+      build.kernelProps = kernelProps;
+
       const bool verbose = kernelProps.get("verbose", false);
       if (foundBinary) {
         if (verbose) {
@@ -254,21 +480,48 @@ namespace occa {
                      << io::shortname(filename)
                      << "] in [" << io::shortname(binaryFilename) << "]\n";
         }
-        modeKernel_t *k = buildKernelFromBinary(binaryFilename,
-                                                kernelName,
-                                                kernelProps);
-        if (k) {
-          k->sourceFilename = filename;
-        }
-        return k;
+        build.foundBinary = true;
+        return;
       }
 
       std::string sourceFilename;
-      lang::sourceMetadata_t metadata;
+      lang::sourceMetadata_t &metadata = build.metadata;
       const bool compilingOkl = kernelProps.get("okl/enabled", true);
-      const bool compilingCpp = (
-        ((int) kernelProps["compiler_language"]) == sys::language::CPP
-      );
+
+      const std::string compiler = kernelProps["compiler"];
+      std::string compilerFlags = kernelProps["compiler_flags"];
+      std::string compilerLinkerFlags = kernelProps["compiler_linker_flags"];
+      std::string compilerSharedFlags = kernelProps["compiler_shared_flags"];
+
+      sys::addCompilerFlags(compilerFlags, compilerSharedFlags);
+
+      if (!compilingOkl) {
+        sys::addCompilerIncludeFlags(compilerFlags);
+        sys::addCompilerLibraryFlags(compilerFlags);
+      }
+
+      // Replace the standard kernel includes with a precompiled header
+      occa::properties parserProps = kernelProps;
+      std::string pchFlags;
+      if (!isLauncherKernel
+          && compilingOkl
+          && compilingCpp
+          && kernelProps.get("pch/enabled", true)) {
+        const std::string prelude = getKernelPrelude(kernelProps,
+                                                     compiler,
+                                                     compilerFlags,
+                                                     compilerEnvScript,
+                                                     pchFlags);
+        if (prelude.size()) {
+          parserProps["serial/prelude"] = prelude;
+        }
+      }
+
+      // Kernels are launched through a trampoline with their own signature
+      //   instead of a switch on the argument count
+      if (!isLauncherKernel && compilingCpp) {
+        parserProps["serial/trampolines"] = true;
+      }
 
       if (isLauncherKernel) {
         sourceFilename = filename;
@@ -291,10 +544,12 @@ namespace occa {
           const std::string outputFile = hashDir + kc::sourceFile;
           bool valid = parseFile(sourceFilename,
                                  outputFile,
-                                 kernelProps,
+                                 parserProps,
                                  metadata);
           if (!valid) {
-            return NULL;
+            build.lock.release();
+            build.isValid = false;
+            return;
           }
           sourceFilename = outputFile;
 
@@ -306,28 +561,16 @@ namespace occa {
       }
 
       std::stringstream command;
-      std::string compilerEnvScript = kernelProps["compiler_env_script"];
       if (compilerEnvScript.size()) {
         command << compilerEnvScript << " && ";
       }
 
-      const std::string compiler = kernelProps["compiler"];
-      std::string compilerFlags = kernelProps["compiler_flags"];
-      std::string compilerLinkerFlags = kernelProps["compiler_linker_flags"];
-      std::string compilerSharedFlags = kernelProps["compiler_shared_flags"];
-
-      sys::addCompilerFlags(compilerFlags, compilerSharedFlags);
-
-      if (!compilingOkl) {
-        sys::addCompilerIncludeFlags(compilerFlags);
-        sys::addCompilerLibraryFlags(compilerFlags);
-      }
-
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
       command << compiler
               << ' '    << compilerFlags
+              << pchFlags
               << ' '    << sourceFilename
-              << " -o " << binaryFilename
+              << " -o " << sharedBinaryFilename
               << " -I"  << env::OCCA_DIR << "include"
               << " -I"  << env::OCCA_INSTALL_DIR << "include"
               << " -L"  << env::OCCA_INSTALL_DIR << "lib -locca"
@@ -345,37 +588,30 @@ namespace occa {
               << ' '       << sourceFilename
               << " /link " << env::OCCA_INSTALL_DIR << "lib/libocca.lib",
               << ' '       << compilerLinkerFlags
-              << " /OUT:"  << binaryFilename
+              << " /OUT:"  << sharedBinaryFilename
               << std::endl;
 #endif
 
-      const std::string &sCommand = strip(command.str());
+      build.command = strip(command.str());
 
-      if (verbose) {
-        io::stdout << "Compiling [" << kernelName << "]\n" << sCommand << "\n";
-      }
-
-#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      const int compileError = system(sCommand.c_str());
-#else
-      const int compileError = system(("\"" +  sCommand + "\"").c_str());
-#endif
-
-      lock.release();
-      if (compileError) {
-        OCCA_FORCE_ERROR("Error compiling [" << kernelName << "],"
-                         " Command: [" << sCommand << ']');
+      if (usingJit) {
+        build.usingJit = true;
+        build.sourceFilename = sourceFilename;
+        build.jitCompilerFlags = (
+          compilerFlags
+          + " -I" + env::OCCA_DIR + "include"
+          + " -I" + env::OCCA_INSTALL_DIR + "include"
+        );
       }
 
-      modeKernel_t *k = buildKernelFromBinary(binaryFilename,
-                                              kernelName,
-                                              kernelProps,
-                                              metadata.kernelsMetadata[kernelName]);
-      if (k) {
-        io::markCachedFileComplete(hashDir, kcBinaryFile);
-        k->sourceFilename = filename;
+      if (verbose) {
+        if (usingJit) {
+          io::stdout << "Compiling [" << kernelName << "] in-process\n"
+                     << build.jitCompilerFlags << ' ' << sourceFilename << "\n";
+        } else {
+          io::stdout << "Compiling [" << kernelName << "]\n" << build.command << "\n";
+        }
       }
-      return k;
     }
 
     modeKernel_t* device::buildKernelFromBinary(const std::string &filename,
@@ -408,8 +644,24 @@ namespace occa {
       k.binaryFilename = filename;
       k.metadata = metadata;
 
-      k.dlHandle = sys::dlopen(filename);
-      k.function = sys::dlsym(k.dlHandle, kernelName);
+      const std::string trampolineName = (
+        lang::okl::serialParser::trampolinePrefix + kernelName
+      );
+      functionPtr_t trampoline;
+
+      k.binary = std::make_shared<kernelBinary>();
+      kernelBinary &binary = *(k.binary);
+      if (io::basename(filename) == kc::jitBinaryFile) {
+        binary.jitHandle = jit::load(filename);
+        k.function = jit::lookup(binary.jitHandle, kernelName);
+        trampoline = jit::tryLookup(binary.jitHandle, trampolineName);
+      } else {
+        binary.dlHandle = sys::dlopen(filename);
+        k.function = sys::dlsym(binary.dlHandle, kernelName);
+        trampoline = sys::tryDlsym(binary.dlHandle, trampolineName);
+      }
+      // Binaries from C or non-OKL sources don't have a trampoline
+      ::memcpy(&k.trampoline, &trampoline, sizeof(trampoline));
 
       return &k;
     }
@@ -425,9 +677,20 @@ namespace occa {
         mem->ptr = (char*) const_cast<void*>(src);
         mem->isOrigin = props.get("own_host_pointer", false);
       } else {
-        mem->ptr = (char*) sys::malloc(bytes);
+        // Never align below the default so vectorized kernels can rely on it
+        const udim_t alignment = std::max(
+          (udim_t) props.get("alignment", (int) env::OCCA_MEM_BYTE_ALIGN),
+          (udim_t) OCCA_DEFAULT_MEM_BYTE_ALIGN
+        );
+        mem->ptr = (char*) sys::malloc(bytes, alignment);
         if (src) {
-          ::memcpy(mem->ptr, src, bytes);
+          if (mem->parallelCopies) {
+            hostMemcpy(mem->ptr, src, bytes);
+          } else {
+            ::memcpy(mem->ptr, src, bytes);
+          }
+        } else if (props.get("first_touch", false)) {
+          hostFirstTouch(mem->ptr, bytes);
         }
       }
 
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+#include <occa/core/asyncKernel.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/graph.hpp>
+#include <occa/modes/serial/kernel.hpp>
+
+namespace occa {
+  namespace serial {
+    graph::graph(modeDevice_t *modeDevice_,
+                 const occa::properties &properties_) :
+      modeGraph_t(modeDevice_, properties_),
+      threadCount(1),
+      pool(NULL),
+      failed(false) {}
+
+    graph::~graph() {
+      delete pool;
+      pool = NULL;
+    }
+
+    void graph::finishCapture() {
+      const int nodeCount = (int) nodes.size();
+
+      nodeKernels.assign(nodeCount, NULL);
+      nodePointers.assign(nodeCount, std::vector<void*>());
+      dependents.assign(nodeCount, std::vector<int>());
+      roots.clear();
+      std::vector<std::atomic<int> >(nodeCount).swap(pendingDependencies);
+
+      std::set<modeStream_t*> streams;
+      for (int i = 0; i < nodeCount; ++i) {
+        graphNode &node = nodes[i];
+        streams.insert(node.modeStream);
+
+        const int depCount = (int) node.dependencies.size();
+        if (!depCount) {
+          roots.push_back(i);
+        }
+        for (int d = 0; d < depCount; ++d) {
+          dependents[node.dependencies[d]].push_back(i);
+        }
+
+        std::vector<void*> &ptrs = nodePointers[i];
+        if (node.type & graphNodeType::copy) {
+          ptrs.resize(2);
+          ptrs[0] = (node.destMemory
+                     ? (void*) (node.destMemory->ptr + node.destOffset)
+                     : node.destPtr);
+          ptrs[1] = (node.srcMemory
+                     ? (void*) (node.srcMemory->ptr + node.srcOffset)
+                     : const_cast<void*>(node.srcPtr));
+          continue;
+        }
+
+        // Replays always use the optimized kernel
+        modeKernel_t *modeKernel = node.modeKernel;
+        asyncModeKernel_t *asyncKernel = dynamic_cast<asyncModeKernel_t*>(modeKernel);
+        if (asyncKernel) {
+          modeKernel = asyncKernel->getOptimizedKernel();
+        }
+        nodeKernels[i] = dynamic_cast<kernel*>(modeKernel);
+        OCCA_ERROR("Graph kernel [" << node.modeKernel->name << "]"
+                   << " was not built for a host device",
+                   nodeKernels[i] != NULL);
+
+        // Pointers to values point into the node's own arguments
+        const int argc = (int) node.arguments.size();
+        ptrs.resize(argc ? argc : 1);
+        for (int a = 0; a < argc; ++a) {
+          ptrs[a] = node.arguments[a].ptr();
+        }
+      }
+
+      // Only work captured on different streams can run concurrently
+      const int maxThreads = properties.get("threads",
+                                            threadPool::defaultThreadCount());
+      threadCount = std::min(maxThreads, (int) streams.size());
+    }
+
+    void graph::run() {
+      const int nodeCount = (int) nodes.size();
+      if (!nodeCount) {
+        return;
+      }
+
+      // Work queued before the replay finishes first
+      ((device*) modeDevice)->finishAllStreams();
+
+      if (threadCount <= 1) {
+        for (int i = 0; i < nodeCount; ++i) {
+          runNode(i);
+        }
+        return;
+      }
+
+      if (!pool) {
+        pool = new threadPool(threadCount);
+      }
+      for (int i = 0; i < nodeCount; ++i) {
+        pendingDependencies[i] = (int) nodes[i].dependencies.size();
+      }
+      failed = false;
+      error = std::exception_ptr();
+
+      const int rootCount = (int) roots.size();
+      for (int i = 0; i < rootCount; ++i) {
+        const int root = roots[i];
+        pool->push([this, root]() {
+          runConcurrentNode(root);
+        });
+      }
+      pool->wait();
+
+      if (failed) {
+        std::exception_ptr runError = error;
+        error = std::exception_ptr();
+        std::rethrow_exception(runError);
+      }
+    }
+
+    void graph::runNode(const int index) {
+      void **ptrs = &(nodePointers[index][0]);
+
+      kernel *nodeKernel = nodeKernels[index];
+      if (nodeKernel) {
+        nodeKernel->launch((int) nodes[index].arguments.size(), ptrs);
+      } else {
+        ::memcpy(ptrs[0], ptrs[1], nodes[index].bytes);
+      }
+    }
+
+    void graph::runConcurrentNode(const int index) {
+      int nextIndex = index;
+      while (nextIndex >= 0) {
+        const int nodeIndex = nextIndex;
+        nextIndex = -1;
+
+        // Nodes after a failure are skipped but still released
+        //   so the replay can finish
+        if (!failed) {
+          try {
+            runNode(nodeIndex);
+          } catch (...) {
+            std::lock_guard<std::mutex> guard(errorMutex);
+            if (!failed) {
+              error = std::current_exception();
+              failed = true;
+            }
+          }
+        }
+
+        // The first ready dependent keeps running on this thread
+        const std::vector<int> &nodeDependents = dependents[nodeIndex];
+        const int dependentCount = (int) nodeDependents.size();
+        for (int i = 0; i < dependentCount; ++i) {
+          const int dependent = nodeDependents[i];
+          if (--pendingDependencies[dependent]) {
+            continue;
+          }
+          if (nextIndex < 0) {
+            nextIndex = dependent;
+          } else {
+            pool->push([this, dependent]() {
+              runConcurrentNode(dependent);
+            });
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,320 @@
+#include <occa/defines.hpp>
+#include <occa/modes/serial/jit.hpp>
+
+#if OCCA_JIT_ENABLED
+#  include <memory>
+#  include <mutex>
+
+#  include <clang/Basic/DiagnosticOptions.h>
+#  include <clang/CodeGen/CodeGenAction.h>
+#  include <clang/Driver/Compilation.h>
+#  include <clang/Driver/Driver.h>
+#  include <clang/Driver/Tool.h>
+#  include <clang/Frontend/CompilerInstance.h>
+#  include <clang/Frontend/CompilerInvocation.h>
+#  include <clang/Frontend/TextDiagnosticPrinter.h>
+
+#  include <llvm/Config/llvm-config.h>
+#  if (LLVM_VERSION_MAJOR < 14) || (LLVM_VERSION_MAJOR > 15)
+#    error "In-process compilation (OCCA_JIT_ENABLED) supports LLVM 14 and 15"
+#  endif
+
+#  include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#  include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#  include <llvm/IR/LegacyPassManager.h>
+#  include <llvm/IR/Module.h>
+#  include <llvm/Support/FileSystem.h>
+#  include <llvm/Support/Host.h>
+#  include <llvm/Support/MemoryBuffer.h>
+#  include <llvm/Support/TargetSelect.h>
+#  include <llvm/Support/raw_ostream.h>
+#  include <llvm/Target/TargetMachine.h>
+#  include <llvm/Target/TargetOptions.h>
+#  include <llvm/MC/TargetRegistry.h>
+#endif
+
+#include <occa/tools/string.hpp>
+
+namespace occa {
+  namespace serial {
+    namespace jit {
+#if OCCA_JIT_ENABLED
+      class jitSession {
+      public:
+        std::unique_ptr<llvm::orc::LLJIT> jit;
+      };
+
+      static void initializeLLVM() {
+        static std::once_flag initialized;
+        std::call_once(initialized, []() {
+            llvm::InitializeNativeTarget();
+            llvm::InitializeNativeTargetAsmPrinter();
+            llvm::InitializeNativeTargetAsmParser();
+          });
+      }
+
+      static std::string errorToString(llvm::Error error) {
+        return llvm::toString(std::move(error));
+      }
+
+      bool isAvailable() {
+        return true;
+      }
+
+      bool compile(const std::string &sourceFilename,
+                   const std::string &objectFilename,
+                   const std::string &compilerFlags,
+                   std::string &errors) {
+        initializeLLVM();
+
+        llvm::raw_string_ostream errorStream(errors);
+
+        llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> diagOptions(
+          new clang::DiagnosticOptions()
+        );
+        clang::TextDiagnosticPrinter *diagPrinter = (
+          new clang::TextDiagnosticPrinter(errorStream, &*diagOptions)
+        );
+        llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs> diagIds(
+          new clang::DiagnosticIDs()
+        );
+        clang::DiagnosticsEngine diags(diagIds, &*diagOptions, diagPrinter);
+
+        // Let the clang driver find the system headers and resource directory
+        //   and give us the -cc1 arguments
+        clang::driver::Driver driver(OCCA_JIT_CLANG_PATH,
+                                     llvm::sys::getProcessTriple(),
+                                     diags,
+                                     "occa jit");
+        driver.setCheckInputsExist(false);
+
+        strVector flags = split(compilerFlags, ' ');
+        std::vector<const char*> args;
+        args.push_back(OCCA_JIT_CLANG_PATH);
+        args.push_back("-fsyntax-only");
+        for (const std::string &flag : flags) {
+          // Shared-library flags don't apply to an object linked in-process
+          if (flag.size()
+              && (flag != "-shared")
+              && (flag != "-fPIC")) {
+            args.push_back(flag.c_str());
+          }
+        }
+        args.push_back(sourceFilename.c_str());
+
+        std::unique_ptr<clang::driver::Compilation> compilation(
+          driver.BuildCompilation(args)
+        );
+        if (!compilation
+            || (compilation->getJobs().size() != 1)
+            || !llvm::isa<clang::driver::Command>(*compilation->getJobs().begin())) {
+          errorStream << "Unable to setup the clang compilation\n";
+          errorStream.flush();
+          return false;
+        }
+
+        const clang::driver::Command &command = (
+          llvm::cast<clang::driver::Command>(*compilation->getJobs().begin())
+        );
+        const llvm::opt::ArgStringList &ccArgs = command.getArguments();
+
+        std::unique_ptr<clang::CompilerInvocation> invocation(
+          new clang::CompilerInvocation()
+        );
+        clang::CompilerInvocation::CreateFromArgs(*invocation, ccArgs, diags);
+
+        clang::CompilerInstance compiler;
+        compiler.setInvocation(std::move(invocation));
+        compiler.createDiagnostics(
+          new clang::TextDiagnosticPrinter(errorStream, &compiler.getDiagnosticOpts())
+        );
+        if (!compiler.hasDiagnostics()) {
+          errorStream.flush();
+          return false;
+        }
+
+        llvm::LLVMContext context;
+        clang::EmitLLVMOnlyAction action(&context);
+        if (!compiler.ExecuteAction(action)) {
+          errorStream.flush();
+          return false;
+        }
+        std::unique_ptr<llvm::Module> module = action.takeModule();
+        if (!module) {
+          errorStream.flush();
+          return false;
+        }
+
+        // Emit a relocatable object so later runs skip the compile
+        std::string targetError;
+        const llvm::Target *target = llvm::TargetRegistry::lookupTarget(
+          module->getTargetTriple(),
+          targetError
+        );
+        if (!target) {
+          errorStream << targetError << '\n';
+          errorStream.flush();
+          return false;
+        }
+
+        llvm::TargetOptions targetOptions;
+        std::unique_ptr<llvm::TargetMachine> targetMachine(
+          target->createTargetMachine(module->getTargetTriple(),
+                                      llvm::sys::getHostCPUName(),
+                                      "",
+                                      targetOptions,
+                                      llvm::Reloc::PIC_,
+                                      llvm::None,
+                                      llvm::CodeGenOpt::Aggressive)
+        );
+        module->setDataLayout(targetMachine->createDataLayout());
+
+        std::error_code errorCode;
+        llvm::raw_fd_ostream objectStream(objectFilename,
+                                          errorCode,
+                                          llvm::sys::fs::OF_None);
+        if (errorCode) {
+          errorStream << "Unable to write [" << objectFilename << "]: "
+                      << errorCode.message() << '\n';
+          errorStream.flush();
+          return false;
+        }
+
+        llvm::legacy::PassManager passManager;
+        if (targetMachine->addPassesToEmitFile(passManager,
+                                               objectStream,
+                                               NULL,
+                                               llvm::CGFT_ObjectFile)) {
+          errorStream << "Unable to emit an object file for the host target\n";
+          errorStream.flush();
+          return false;
+        }
+        passManager.run(*module);
+        objectStream.flush();
+
+        errorStream.flush();
+        return true;
+      }
+
+      void* load(const std::string &objectFilename) {
+        initializeLLVM();
+
+        llvm::Expected<std::unique_ptr<llvm::orc::LLJIT>> jit = (
+          llvm::orc::LLJITBuilder().create()
+        );
+        OCCA_ERROR("Unable to create a JIT session: "
+                   << (jit ? "" : errorToString(jit.takeError())),
+                   !!jit);
+
+        // Resolve libocca and libstdc++ symbols from the running process
+        llvm::orc::JITDylib &dylib = (*jit)->getMainJITDylib();
+        llvm::Expected<std::unique_ptr<llvm::orc::DynamicLibrarySearchGenerator>> processSymbols = (
+          llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+            (*jit)->getDataLayout().getGlobalPrefix()
+          )
+        );
+        OCCA_ERROR("Unable to load process symbols: "
+                   << (processSymbols ? "" : errorToString(processSymbols.takeError())),
+                   !!processSymbols);
+        dylib.addGenerator(std::move(*processSymbols));
+
+        llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> objectBuffer = (
+          llvm::MemoryBuffer::getFile(objectFilename)
+        );
+        OCCA_ERROR("Unable to read [" << objectFilename << "]",
+                   !!objectBuffer);
+
+        llvm::Error error = (*jit)->addObjectFile(std::move(*objectBuffer));
+        OCCA_ERROR("Unable to link [" << objectFilename << "]: "
+                   << (error ? errorToString(std::move(error)) : ""),
+                   !error);
+
+        // Run static initializers
+        error = (*jit)->initialize(dylib);
+        OCCA_ERROR("Unable to initialize [" << objectFilename << "]: "
+                   << (error ? errorToString(std::move(error)) : ""),
+                   !error);
+
+        jitSession *session = new jitSession();
+        session->jit = std::move(*jit);
+        return session;
+      }
+
+      functionPtr_t lookup(void *handle,
+                           const std::string &functionName) {
+        jitSession &session = *((jitSession*) handle);
+
+        auto symbol = session.jit->lookup(functionName);
+        OCCA_ERROR("Unable to find [" << functionName << "]: "
+                   << (symbol ? "" : errorToString(symbol.takeError())),
+                   !!symbol);
+
+#if LLVM_VERSION_MAJOR >= 15
+        return symbol->toPtr<functionPtr_t>();
+#else
+        return (functionPtr_t) symbol->getAddress();
+#endif
+      }
+
+      functionPtr_t tryLookup(void *handle,
+                              const std::string &functionName) {
+        jitSession &session = *((jitSession*) handle);
+
+        auto symbol = session.jit->lookup(functionName);
+        if (!symbol) {
+          llvm::consumeError(symbol.takeError());
+          return NULL;
+        }
+
+#if LLVM_VERSION_MAJOR >= 15
+        return symbol->toPtr<functionPtr_t>();
+#else
+        return (functionPtr_t) symbol->getAddress();
+#endif
+      }
+
+      void free(void *handle) {
+        jitSession *session = (jitSession*) handle;
+        if (!session) {
+          return;
+        }
+        llvm::Error error = session->jit->deinitialize(session->jit->getMainJITDylib());
+        if (error) {
+          llvm::consumeError(std::move(error));
+        }
+        delete session;
+      }
+#else
+      bool isAvailable() {
+        return false;
+      }
+
+      bool compile(const std::string &sourceFilename,
+                   const std::string &objectFilename,
+                   const std::string &compilerFlags,
+                   std::string &errors) {
+        errors = "occa was built without in-process compilation (OCCA_JIT_ENABLED)";
+        return false;
+      }
+
+      void* load(const std::string &objectFilename) {
+        OCCA_FORCE_ERROR("occa was built without in-process compilation (OCCA_JIT_ENABLED)");
+        return NULL;
+      }
+
+      functionPtr_t lookup(void *handle,
+                           const std::string &functionName) {
+        OCCA_FORCE_ERROR("occa was built without in-process compilation (OCCA_JIT_ENABLED)");
+        return NULL;
+      }
+
+      functionPtr_t tryLookup(void *handle,
+                              const std::string &functionName) {
+        return NULL;
+      }
+
+      void free(void *handle) {}
+#endif
+    }
+  }
+}
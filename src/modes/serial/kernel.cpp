@@ -1,24 +1,40 @@
 #include <occa/core/base.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/io.hpp>
+#include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/jit.hpp>
 #include <occa/modes/serial/kernel.hpp>
+#include <occa/modes/serial/stream.hpp>
 #include <occa/lang/modes/serial.hpp>
 
 namespace occa {
   namespace serial {
+    kernelBinary::kernelBinary() :
+      dlHandle(NULL),
+      jitHandle(NULL) {}
+
+    kernelBinary::~kernelBinary() {
+      if (dlHandle) {
+        sys::dlclose(dlHandle);
+      }
+      if (jitHandle) {
+        jit::free(jitHandle);
+      }
+    }
+
     kernel::kernel(modeDevice_t *modeDevice_,
                    const std::string &name_,
                    const std::string &sourceFilename_,
                    const occa::properties &properties_) :
       occa::modeKernel_t(modeDevice_, name_, sourceFilename_, properties_),
-      dlHandle(NULL),
       function(NULL),
+      trampoline(NULL),
+      queuedRuns(0),
       isLauncherKernel(false) {}
 
     kernel::~kernel() {
-      if (dlHandle) {
-        sys::dlclose(dlHandle);
-        dlHandle = NULL;
+      if (queuedRuns) {
+        ((device*) modeDevice)->finishAllStreams();
       }
     }
 
@@ -39,19 +55,65 @@ namespace occa {
     }
 
     void kernel::run() const {
-      const int args = (int) arguments.size();
+      stream *currentStream = ((device*) modeDevice)->getCurrentStream();
+      if (!currentStream || !currentStream->isAsync()) {
+        runWithArguments(arguments, vArgs);
+        return;
+      }
+
+      // Launches on async streams keep their own copy of the arguments,
+      //   including values the caller passed by pointer
+      ++queuedRuns;
+      std::vector<kernelArgData> launchArgs = arguments;
+      const int argc = (int) launchArgs.size();
+      for (int i = 0; i < argc; ++i) {
+        launchArgs[i].ownValue();
+      }
+      currentStream->enqueue([this, launchArgs]() {
+        std::vector<void*> launchPtrs;
+        runWithArguments(launchArgs, launchPtrs);
+        --queuedRuns;
+      });
+    }
+
+    modeKernel_t* kernel::clone() const {
+      kernel *k = new kernel(modeDevice,
+                             name,
+                             sourceFilename,
+                             properties);
+      k->binaryFilename = binaryFilename;
+      k->metadata = metadata;
+      k->isLauncherKernel = isLauncherKernel;
+      // The binary isn't loaded again
+      k->binary = binary;
+      k->function = function;
+      k->trampoline = trampoline;
+      return k;
+    }
+
+    void kernel::runWithArguments(const std::vector<kernelArgData> &launchArgs,
+                                  std::vector<void*> &launchPtrs) const {
+      const int args = (int) launchArgs.size();
       if (!args) {
-        vArgs.resize(1);
-      } else if ((int) vArgs.size() < args) {
-        vArgs.resize(args);
+        launchPtrs.resize(1);
+      } else if ((int) launchPtrs.size() < args) {
+        launchPtrs.resize(args);
       }
 
       // Set arguments
       for (int i = 0; i < args; ++i) {
-        vArgs[i] = arguments[i].ptr();
+        launchPtrs[i] = launchArgs[i].ptr();
       }
 
-      sys::runFunction(function, args, &(vArgs[0]));
+      launch(args, &(launchPtrs[0]));
+    }
+
+    void kernel::launch(const int argc, void **args) const {
+      if (trampoline) {
+        trampoline(args);
+      } else {
+        sys::runFunction(function, argc, args);
+      }
     }
   }
 }
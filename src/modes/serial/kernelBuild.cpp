@@ -0,0 +1,83 @@
+#include <cstdlib>
+
+#include <occa/io.hpp>
+#include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/jit.hpp>
+#include <occa/modes/serial/kernelBuild.hpp>
+
+namespace occa {
+  namespace serial {
+    kernelBuild::kernelBuild(device *modeDevice_) :
+      modeDevice(modeDevice_),
+      isValid(true),
+      foundBinary(false),
+      compileError(0),
+      usingJit(false) {}
+
+    bool kernelBuild::needsCompile() const {
+      return isValid && !foundBinary;
+    }
+
+    void kernelBuild::compile() {
+      if (!needsCompile()) {
+        return;
+      }
+
+      if (usingJit) {
+        std::string errors;
+        if (jit::compile(sourceFilename, binaryFilename, jitCompilerFlags, errors)) {
+          lock.release();
+          return;
+        }
+        if (kernelProps.get("verbose", false)) {
+          io::stderr << "In-process compilation of [" << kernelName << "] failed,"
+                     << " using [" << command << "]\n"
+                     << errors;
+        }
+        usingJit = false;
+        kcBinaryFile = kc::binaryFile;
+        binaryFilename = sharedBinaryFilename;
+      }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      compileError = system(command.c_str());
+#else
+      compileError = system(("\"" +  command + "\"").c_str());
+#endif
+
+      lock.release();
+    }
+
+    modeKernel_t* kernelBuild::finish() {
+      if (!isValid) {
+        return NULL;
+      }
+
+      if (foundBinary) {
+        modeKernel_t *k = modeDevice->buildKernelFromBinary(binaryFilename,
+                                                            kernelName,
+                                                            kernelProps);
+        if (k) {
+          k->sourceFilename = filename;
+        }
+        return k;
+      }
+
+      if (compileError) {
+        OCCA_FORCE_ERROR("Error compiling [" << kernelName << "],"
+                         " Command: [" << command << ']');
+      }
+
+      modeKernel_t *k = modeDevice->buildKernelFromBinary(binaryFilename,
+                                                          kernelName,
+                                                          kernelProps,
+                                                          metadata.kernelsMetadata[kernelName]);
+      // Only cache binaries that loaded, otherwise they get rebuilt next time
+      if (k) {
+        io::markCachedFileComplete(hashDir, kcBinaryFile);
+        k->sourceFilename = filename;
+      }
+      return k;
+    }
+  }
+}
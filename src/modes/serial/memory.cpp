@@ -1,4 +1,7 @@
+#include <occa/modes/serial/device.hpp>
 #include <occa/modes/serial/memory.hpp>
+#include <occa/modes/serial/stream.hpp>
+#include <occa/tools/hostCopy.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/core/device.hpp>
 
@@ -7,21 +10,27 @@ namespace occa {
     memory::memory(modeDevice_t *modeDevice_,
                    udim_t size_,
                    const occa::properties &properties_) :
-      occa::modeMemory_t(modeDevice_, size_, properties_) {}
+      occa::modeMemory_t(modeDevice_, size_, properties_),
+      parallelCopies(properties_.get("parallel_copies", false)) {}
 
     memory::~memory() {
       if (ptr && isOrigin) {
+        // Queued work might still be using the pointer
+        device *serialDevice = (device*) modeDevice;
+        if (serialDevice && serialDevice->hasAsyncStreams()) {
+          serialDevice->finishAllStreams();
+        }
         sys::free(ptr);
       }
       ptr = NULL;
       size = 0;
     }
 
-    kernelArg memory::makeKernelArg() const {
+    kernelArg memory::makeKernelArg(const udim_t offset) const {
       kernelArgData arg;
 
       arg.modeMemory = const_cast<memory*>(this);
-      arg.data.void_ = ptr;
+      arg.data.void_ = ptr + offset;
       arg.size       = sizeof(void*);
       arg.info       = kArgInfo::usePointer;
 
@@ -42,7 +51,7 @@ namespace occa {
                         const occa::properties &props) const {
       const void *srcPtr = ptr + offset;
 
-      ::memcpy(dest, srcPtr, bytes);
+      streamMemcpy(dest, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const void *src,
@@ -53,7 +62,7 @@ namespace occa {
       void *destPtr      = ptr + offset;
       const void *srcPtr = src;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      streamMemcpy(destPtr, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const modeMemory_t *src,
@@ -65,7 +74,47 @@ namespace occa {
       void *destPtr      = ptr + destOffset;
       const void *srcPtr = src->ptr + srcOffset;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      streamMemcpy(destPtr, srcPtr, bytes, props);
+    }
+
+    void memory::streamMemcpy(void *dest,
+                              const void *src,
+                              const udim_t bytes,
+                              const occa::properties &props) const {
+      stream *currentStream = (
+        modeDevice
+        ? ((device*) modeDevice)->getCurrentStream()
+        : NULL
+      );
+
+      const bool parallel = parallelCopies;
+
+      if (!currentStream || !currentStream->isAsync()) {
+        hostCopy(dest, src, bytes, parallel);
+        return;
+      }
+
+      if (props.get("async", false)) {
+        currentStream->enqueue([dest, src, bytes, parallel]() {
+          hostCopy(dest, src, bytes, parallel);
+        });
+        return;
+      }
+
+      // Synchronous copies wait for work queued before them
+      currentStream->finish();
+      hostCopy(dest, src, bytes, parallel);
+    }
+
+    void memory::hostCopy(void *dest,
+                          const void *src,
+                          const udim_t bytes,
+                          const bool parallel) {
+      if (parallel) {
+        hostMemcpy(dest, src, bytes);
+      } else {
+        ::memcpy(dest, src, bytes);
+      }
     }
 
     void memory::detach() {
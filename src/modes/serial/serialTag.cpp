@@ -1,14 +1,45 @@
 #include <occa/defines.hpp>
 
 #include <occa/modes/serial/streamTag.hpp>
+#include <occa/tools/sys.hpp>
 
 namespace occa {
   namespace serial {
     streamTag::streamTag(modeDevice_t *modeDevice_,
                          double time_) :
       modeStreamTag_t(modeDevice_),
-      time(time_) {}
+      time(time_),
+      reached(true) {}
 
-    streamTag::~streamTag() {}
+    streamTag::streamTag(modeDevice_t *modeDevice_) :
+      modeStreamTag_t(modeDevice_),
+      time(0),
+      reached(false) {}
+
+    streamTag::~streamTag() {
+      // The stream worker still references unreached tags
+      wait();
+    }
+
+    void streamTag::record() {
+      {
+        std::unique_lock<std::mutex> guard(mutex);
+        time = sys::currentTime();
+        reached = true;
+      }
+      reachedCondition.notify_all();
+    }
+
+    bool streamTag::isReached() {
+      std::unique_lock<std::mutex> guard(mutex);
+      return reached;
+    }
+
+    void streamTag::wait() {
+      std::unique_lock<std::mutex> guard(mutex);
+      while (!reached) {
+        reachedCondition.wait(guard);
+      }
+    }
   }
 }
@@ -1,11 +1,43 @@
+#include <occa/modes/serial/device.hpp>
 #include <occa/modes/serial/stream.hpp>
 
 namespace occa {
   namespace serial {
     stream::stream(modeDevice_t *modeDevice_,
                    const occa::properties &properties_) :
-      modeStream_t(modeDevice_, properties_) {}
+      modeStream_t(modeDevice_, properties_),
+      queue(NULL) {
+      if (properties.get("async", false)) {
+        queue = new threadPool(1);
+        ((device*) modeDevice)->addAsyncStream();
+      }
+    }
 
-    stream::~stream() {}
+    stream::~stream() {
+      if (queue) {
+        // Queued work is drained before the worker exits
+        delete queue;
+        queue = NULL;
+        ((device*) modeDevice)->removeAsyncStream();
+      }
+    }
+
+    bool stream::isAsync() const {
+      return queue;
+    }
+
+    void stream::enqueue(const threadPool::job_t &job) {
+      if (queue) {
+        queue->push(job);
+      } else {
+        job();
+      }
+    }
+
+    void stream::finish() {
+      if (queue) {
+        queue->wait();
+      }
+    }
   }
 }
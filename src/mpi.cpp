@@ -2,8 +2,16 @@
 
 #if OCCA_MPI_ENABLED
 
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+
 #include <occa/core/base.hpp>
+#include <occa/io.hpp>
 #include <occa/mpi.hpp>
+#include <occa/tools/env.hpp>
+#include <occa/tools/string.hpp>
+#include <occa/tools/sys.hpp>
 #include <occa/tools/tls.hpp>
 
 namespace occa {
@@ -47,6 +55,239 @@ namespace occa {
       MPI_Barrier(MPI_COMM_WORLD);
     }
 
+    //---[ Nodes ]----------------------
+    class nodeComms_t {
+    public:
+      MPI_Comm node;
+      MPI_Comm leaders;
+      int nodeId;
+      int nodeSize;
+
+      nodeComms_t() {
+        const int ranksPerNode = settings().get("mpi/ranks_per_node", 0);
+        if (ranksPerNode > 0) {
+          MPI_Comm_split(MPI_COMM_WORLD,
+                         id() / ranksPerNode,
+                         id(),
+                         &node);
+        } else {
+          MPI_Comm_split_type(MPI_COMM_WORLD,
+                              MPI_COMM_TYPE_SHARED,
+                              id(),
+                              MPI_INFO_NULL,
+                              &node);
+        }
+        MPI_Comm_rank(node, &nodeId);
+        MPI_Comm_size(node, &nodeSize);
+
+        // Ranks are ordered by their world id, rank 0 leads its node
+        MPI_Comm_split(MPI_COMM_WORLD,
+                       (nodeId == 0) ? 0 : MPI_UNDEFINED,
+                       id(),
+                       &leaders);
+      }
+    };
+
+    static nodeComms_t& getNodeComms() {
+      static nodeComms_t comms;
+      return comms;
+    }
+
+    MPI_Comm nodeComm() {
+      return getNodeComms().node;
+    }
+
+    MPI_Comm nodeLeaderComm() {
+      return getNodeComms().leaders;
+    }
+
+    int nodeId() {
+      return getNodeComms().nodeId;
+    }
+
+    int nodeSize() {
+      return getNodeComms().nodeSize;
+    }
+
+    bool isNodeLeader() {
+      return (getNodeComms().nodeId == 0);
+    }
+    //==================================
+
+    //---[ Kernel Builds ]--------------
+    static const int buildFailed    = 0;
+    static const int buildSucceeded = 1;
+
+    static void appendString(std::string &buffer,
+                             const std::string &str) {
+      const uint64_t bytes = str.size();
+      buffer.append((const char*) &bytes, sizeof(uint64_t));
+      buffer += str;
+    }
+
+    static std::string readString(const char *&c) {
+      uint64_t bytes;
+      ::memcpy(&bytes, c, sizeof(uint64_t));
+      c += sizeof(uint64_t);
+      std::string str(c, bytes);
+      c += bytes;
+      return str;
+    }
+
+    // Files are packed before sub-directories so the .success markers
+    //   are written after the files they mark
+    static void packDir(const std::string &rootDir,
+                        const std::string &dir,
+                        std::string &buffer) {
+      strVector files = io::files(dir);
+      for (size_t i = 0; i < files.size(); ++i) {
+        appendString(buffer, files[i].substr(rootDir.size()));
+        appendString(buffer, io::read(files[i], true));
+      }
+      strVector dirs = io::directories(dir);
+      for (size_t i = 0; i < dirs.size(); ++i) {
+        packDir(rootDir, dirs[i], buffer);
+      }
+    }
+
+    static void broadcastBuffer(std::string &buffer,
+                                MPI_Comm comm) {
+      uint64_t bytes = buffer.size();
+      MPI_Bcast(&bytes, 1, MPI_UINT64_T, 0, comm);
+      buffer.resize(bytes);
+
+      // MPI counts are ints
+      const uint64_t maxChunkBytes = (1 << 30);
+      for (uint64_t offset = 0; offset < bytes; offset += maxChunkBytes) {
+        const int chunkBytes = (int) std::min(maxChunkBytes, bytes - offset);
+        MPI_Bcast(&(buffer[offset]), chunkBytes, MPI_BYTE, 0, comm);
+      }
+    }
+
+    static void writeCachedFile(const std::string &filename,
+                                const std::string &content) {
+      if (!io::isFile(filename)) {
+        io::atomicWrite(filename, content);
+      }
+    }
+
+    // Sends the kernel's cache directory from the first leader
+    //   to the node-local caches of the other leaders
+    static void broadcastKernelFiles(occa::kernel kernel,
+                                     MPI_Comm leaders) {
+      int leaderId;
+      MPI_Comm_rank(leaders, &leaderId);
+
+      std::string buffer;
+      if (leaderId == 0) {
+        const std::string hashDir = io::dirname(kernel.binaryFilename());
+        const std::string &cachePath = io::cachePath();
+        // Kernels are only found in the cache directory
+        if (startsWith(hashDir, cachePath)) {
+          appendString(buffer, hashDir.substr(cachePath.size()));
+          packDir(hashDir, hashDir, buffer);
+        }
+      }
+
+      broadcastBuffer(buffer, leaders);
+      if ((leaderId == 0) || buffer.empty()) {
+        return;
+      }
+
+      const char *c = buffer.c_str();
+      const char *cEnd = c + buffer.size();
+      const std::string hashDir = io::cachePath() + readString(c);
+      while (c < cEnd) {
+        const std::string filename = hashDir + readString(c);
+        writeCachedFile(filename, readString(c));
+      }
+    }
+
+    // Builders pass their status to the node leaders,
+    //   which pass it to the rest of the node
+    static int shareBuildStatus(const std::string &kernelCache,
+                                int status,
+                                occa::kernel kernel) {
+      nodeComms_t &comms = getNodeComms();
+      if ((kernelCache != "node")
+          && (comms.nodeId == 0)) {
+        MPI_Bcast(&status, 1, MPI_INT, 0, comms.leaders);
+        if ((kernelCache == "broadcast")
+            && (status == buildSucceeded)) {
+          broadcastKernelFiles(kernel, comms.leaders);
+        }
+      }
+      MPI_Bcast(&status, 1, MPI_INT, 0, comms.node);
+      return status;
+    }
+
+    static occa::kernel buildLocalKernel(occa::device device,
+                                         const bool sourceIsString,
+                                         const std::string &source,
+                                         const std::string &kernelName,
+                                         const occa::properties &props) {
+      if (sourceIsString) {
+        return device.buildKernelFromString(source, kernelName, props);
+      }
+      return device.buildKernel(source, kernelName, props);
+    }
+
+    static occa::kernel buildSharedKernel(occa::device device,
+                                          const bool sourceIsString,
+                                          const std::string &source,
+                                          const std::string &kernelName,
+                                          const occa::properties &props) {
+      const std::string kernelCache = settings().get("mpi/kernel_cache",
+                                                     std::string("shared"));
+      OCCA_ERROR("Unknown mpi/kernel_cache [" << kernelCache << "],"
+                 << " expected [shared], [broadcast] or [node]",
+                 ((kernelCache == "shared")
+                  || (kernelCache == "broadcast")
+                  || (kernelCache == "node")));
+
+      const bool isBuilder = (
+        (kernelCache == "node")
+        ? isNodeLeader()
+        : (id() == 0)
+      );
+
+      occa::kernel kernel;
+      if (isBuilder) {
+        try {
+          kernel = buildLocalKernel(device, sourceIsString, source, kernelName, props);
+        } catch (...) {
+          // Don't leave the other ranks waiting
+          shareBuildStatus(kernelCache, buildFailed, kernel);
+          throw;
+        }
+      }
+
+      const int status = shareBuildStatus(kernelCache, buildSucceeded, kernel);
+      OCCA_ERROR("Kernel [" << kernelName << "] failed to build on another rank",
+                 status == buildSucceeded);
+
+      // Load the cached binary
+      if (!isBuilder) {
+        kernel = buildLocalKernel(device, sourceIsString, source, kernelName, props);
+      }
+      return kernel;
+    }
+
+    occa::kernel buildKernel(occa::device device,
+                             const std::string &filename,
+                             const std::string &kernelName,
+                             const occa::properties &props) {
+      return buildSharedKernel(device, false, filename, kernelName, props);
+    }
+
+    occa::kernel buildKernelFromString(occa::device device,
+                                       const std::string &content,
+                                       const std::string &kernelName,
+                                       const occa::properties &props) {
+      return buildSharedKernel(device, true, content, kernelName, props);
+    }
+    //==================================
+
     //---[ Types ]----------------------
     template <>
     MPI_Datatype type<bool>() {
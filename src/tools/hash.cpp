@@ -1,6 +1,13 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <stdint.h>
 
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
 #include <occa/types.hpp>
 #include <occa/tools/hash.hpp>
 #include <occa/tools/env.hpp>
@@ -126,27 +133,212 @@ namespace occa {
     return out;
   }
 
-  hash_t hash(const void *ptr, udim_t bytes) {
-    std::stringstream ss;
-    const char *c = (char*) ptr;
+  //---[ Hasher ]-----------------------
+  static const uint64_t PRIME32_1 = 0x9E3779B1ULL;
+  static const uint64_t PRIME32_2 = 0x85EBCA77ULL;
+  static const uint64_t PRIME32_3 = 0xC2B2AE3DULL;
+  static const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+  static const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+  static const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+  static const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+  static const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
 
-    hash_t hash;
-    int *h = hash.h;
+  static const int hashStripeBytes = 64;
+  static const int hashStripesPerBlock = 16;
+  static const int hashSecretWords = 24;
 
-    const int p[8] = {
-      102679, 102701, 102761, 102763,
-      102769, 102793, 102797, 102811
-    };
+  // Each stripe in a block is keyed by a different window of the secret,
+  //   the last 8 words are used to scramble the lanes after each block
+  class hashSecret_t {
+  public:
+    uint64_t words[hashSecretWords];
 
-    for (udim_t i = 0; i < bytes; ++i) {
-      for (int j = 0; j < 8; ++j) {
-        h[j] = (h[j] * p[j]) ^ c[i];
+    hashSecret_t() {
+      // splitmix64
+      uint64_t state = PRIME64_3;
+      for (int i = 0; i < hashSecretWords; ++i) {
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        words[i] = z ^ (z >> 31);
       }
     }
+  };
+
+  static const uint64_t* getHashSecret() {
+    static const hashSecret_t secret;
+    return secret.words;
+  }
+
+  static inline uint64_t mulFold64(const uint64_t a, const uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = (__uint128_t) a * b;
+    return ((uint64_t) product) ^ ((uint64_t) (product >> 64));
+#else
+    const uint64_t aLo = a & 0xFFFFFFFFULL, aHi = a >> 32;
+    const uint64_t bLo = b & 0xFFFFFFFFULL, bHi = b >> 32;
+    const uint64_t loLo = aLo * bLo;
+    const uint64_t hiLo = aHi * bLo;
+    const uint64_t loHi = aLo * bHi;
+    const uint64_t hiHi = aHi * bHi;
+    const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFULL) + loHi;
+    const uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    const uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFFULL);
+    return lower ^ upper;
+#endif
+  }
+
+  static inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ULL;
+    h ^= h >> 32;
+    return h;
+  }
+
+  static inline void accumulateStripe(uint64_t *acc,
+                                      const unsigned char *ptr,
+                                      const uint64_t *secret) {
+#if defined(__SSE2__)
+    for (int i = 0; i < 4; ++i) {
+      const __m128i data = _mm_loadu_si128((const __m128i*) ptr + i);
+      const __m128i key = _mm_xor_si128(
+        data,
+        _mm_loadu_si128((const __m128i*) secret + i)
+      );
+      // (low 32 bits) * (high 32 bits) of each key lane
+      const __m128i product = _mm_mul_epu32(
+        key,
+        _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1))
+      );
+      // Data is added to the neighboring lane
+      const __m128i swappedData = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+      __m128i *accPtr = (__m128i*) acc + i;
+      _mm_storeu_si128(
+        accPtr,
+        _mm_add_epi64(_mm_loadu_si128(accPtr),
+                      _mm_add_epi64(product, swappedData))
+      );
+    }
+#else
+    for (int i = 0; i < 8; ++i) {
+      uint64_t data;
+      ::memcpy(&data, ptr + (8 * i), sizeof(uint64_t));
+      const uint64_t key = data ^ secret[i];
+      acc[i ^ 1] += data;
+      acc[i] += (key & 0xFFFFFFFFULL) * (key >> 32);
+    }
+#endif
+  }
+
+  static inline void scrambleLanes(uint64_t *acc,
+                                   const uint64_t *secret) {
+    for (int i = 0; i < 8; ++i) {
+      uint64_t a = acc[i];
+      a ^= a >> 47;
+      a ^= secret[i];
+      a *= PRIME32_1;
+      acc[i] = a;
+    }
+  }
+
+  hasher_t::hasher_t() {
+    clear();
+  }
+
+  void hasher_t::clear() {
+    acc[0] = PRIME32_3; acc[1] = PRIME64_1;
+    acc[2] = PRIME64_2; acc[3] = PRIME64_3;
+    acc[4] = PRIME64_4; acc[5] = PRIME32_2;
+    acc[6] = PRIME64_5; acc[7] = PRIME32_1;
+    bufferBytes = 0;
+    stripe = 0;
+    totalBytes = 0;
+  }
+
+  void hasher_t::processStripe(const unsigned char *ptr) {
+    const uint64_t *secret = getHashSecret();
+    accumulateStripe(acc, ptr, secret + stripe);
+    if (++stripe == hashStripesPerBlock) {
+      scrambleLanes(acc, secret + (hashSecretWords - 8));
+      stripe = 0;
+    }
+  }
+
+  hasher_t& hasher_t::update(const void *ptr, const udim_t bytes) {
+    const unsigned char *c = (const unsigned char*) ptr;
+    udim_t remaining = bytes;
+    totalBytes += bytes;
+
+    // Finish a partially filled stripe
+    if (bufferBytes) {
+      const udim_t copyBytes = std::min(remaining,
+                                        (udim_t) (hashStripeBytes - bufferBytes));
+      ::memcpy(buffer + bufferBytes, c, copyBytes);
+      bufferBytes += (int) copyBytes;
+      c += copyBytes;
+      remaining -= copyBytes;
+      if (bufferBytes < hashStripeBytes) {
+        return *this;
+      }
+      processStripe(buffer);
+      bufferBytes = 0;
+    }
+
+    while (remaining >= (udim_t) hashStripeBytes) {
+      processStripe(c);
+      c += hashStripeBytes;
+      remaining -= hashStripeBytes;
+    }
+
+    if (remaining) {
+      ::memcpy(buffer, c, remaining);
+      bufferBytes = (int) remaining;
+    }
+    return *this;
+  }
+
+  hasher_t& hasher_t::update(const std::string &str) {
+    return update(str.c_str(), str.size());
+  }
+
+  hash_t hasher_t::digest() const {
+    const uint64_t *secret = getHashSecret();
+
+    uint64_t lanes[8];
+    for (int i = 0; i < 8; ++i) {
+      lanes[i] = acc[i];
+    }
+
+    // The zero padding is told apart by mixing in the total length
+    if (bufferBytes) {
+      unsigned char lastStripe[hashStripeBytes];
+      ::memset(lastStripe, 0, hashStripeBytes);
+      ::memcpy(lastStripe, buffer, bufferBytes);
+      accumulateStripe(lanes, lastStripe, secret + stripe);
+    }
+
+    // Merge all lanes into each 64-bit word of the hash
+    hash_t hash;
+    for (int k = 0; k < 4; ++k) {
+      uint64_t word = (totalBytes * PRIME64_1) + (k * PRIME64_2);
+      for (int i = 0; i < 4; ++i) {
+        word += mulFold64(lanes[2*i]     ^ secret[k + 2*i],
+                          lanes[2*i + 1] ^ secret[k + 2*i + 1]);
+      }
+      word = avalanche(word);
+      hash.h[2*k]     = (int) (word & 0xFFFFFFFFULL);
+      hash.h[2*k + 1] = (int) (word >> 32);
+    }
     hash.initialized = true;
 
     return hash;
   }
+  //====================================
+
+  hash_t hash(const void *ptr, udim_t bytes) {
+    return hasher_t().update(ptr, bytes).digest();
+  }
 
   hash_t hash(const char *c) {
     return hash(c, strlen(c));
@@ -157,9 +349,21 @@ namespace occa {
   }
 
   hash_t hashFile(const std::string &filename) {
-    const char *c = io::c_read(io::filename(filename));
-    hash_t ret = hash(c);
-    delete [] c;
-    return ret;
+    const std::string expFilename = io::filename(filename);
+
+    FILE *fp = fopen(expFilename.c_str(), "rb");
+    OCCA_ERROR("Failed to open [" << io::shortname(expFilename) << "]",
+               fp != NULL);
+
+    // Stream the file through the hasher instead of reading it all at once
+    hasher_t hasher;
+    char buffer[16384];
+    size_t bytesRead;
+    while ((bytesRead = fread(buffer, sizeof(char), sizeof(buffer), fp)) > 0) {
+      hasher.update(buffer, bytesRead);
+    }
+    fclose(fp);
+
+    return hasher.digest();
   }
 }
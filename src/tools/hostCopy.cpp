@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cstring>
+
+#include <occa/tools/hostCopy.hpp>
+#include <occa/tools/workStealingPool.hpp>
+
+#if OCCA_SSE2
+#  include <emmintrin.h>
+#endif
+
+namespace occa {
+  static const udim_t pageBytes = 4096;
+  // Chunks per thread, leaves some room to steal work from slow threads
+  static const int chunksPerThread = 8;
+
+#if OCCA_SSE2
+  static void nonTemporalMemcpy(char *dest,
+                                const char *src,
+                                udim_t bytes) {
+    // Streaming stores need 16-byte aligned destinations
+    const udim_t head = std::min(bytes,
+                                 (udim_t) ((16 - (((size_t) dest) & 15)) & 15));
+    ::memcpy(dest, src, head);
+    dest  += head;
+    src   += head;
+    bytes -= head;
+
+    const udim_t blocks = bytes / 64;
+    for (udim_t i = 0; i < blocks; ++i) {
+      const __m128i v0 = _mm_loadu_si128(((const __m128i*) src) + 0);
+      const __m128i v1 = _mm_loadu_si128(((const __m128i*) src) + 1);
+      const __m128i v2 = _mm_loadu_si128(((const __m128i*) src) + 2);
+      const __m128i v3 = _mm_loadu_si128(((const __m128i*) src) + 3);
+      _mm_stream_si128(((__m128i*) dest) + 0, v0);
+      _mm_stream_si128(((__m128i*) dest) + 1, v1);
+      _mm_stream_si128(((__m128i*) dest) + 2, v2);
+      _mm_stream_si128(((__m128i*) dest) + 3, v3);
+      dest += 64;
+      src  += 64;
+    }
+    ::memcpy(dest, src, bytes - (64 * blocks));
+
+    // Make the streaming stores visible before the copy returns
+    _mm_sfence();
+  }
+
+  static void nonTemporalMemset(char *dest,
+                                const int value,
+                                udim_t bytes) {
+    const udim_t head = std::min(bytes,
+                                 (udim_t) ((16 - (((size_t) dest) & 15)) & 15));
+    ::memset(dest, value, head);
+    dest  += head;
+    bytes -= head;
+
+    const __m128i v = _mm_set1_epi8((char) value);
+    const udim_t blocks = bytes / 64;
+    for (udim_t i = 0; i < blocks; ++i) {
+      _mm_stream_si128(((__m128i*) dest) + 0, v);
+      _mm_stream_si128(((__m128i*) dest) + 1, v);
+      _mm_stream_si128(((__m128i*) dest) + 2, v);
+      _mm_stream_si128(((__m128i*) dest) + 3, v);
+      dest += 64;
+    }
+    ::memset(dest, value, bytes - (64 * blocks));
+
+    _mm_sfence();
+  }
+#else
+  static void nonTemporalMemcpy(char *dest,
+                                const char *src,
+                                udim_t bytes) {
+    ::memcpy(dest, src, bytes);
+  }
+
+  static void nonTemporalMemset(char *dest,
+                                const int value,
+                                udim_t bytes) {
+    ::memset(dest, value, bytes);
+  }
+#endif
+
+  // Calls func(offset, chunkBytes) over page-aligned chunks of [bytes]
+  //   The work-stealing pool starts each thread with a contiguous,
+  //   even share of the chunks so the split is the same on every call
+  template <class func_t>
+  static void forEachChunk(const udim_t bytes,
+                           func_t func) {
+    const udim_t chunks = chunksPerThread * getHostThreadPool().size();
+    const udim_t chunkBytes = pageBytes * (
+      ((bytes / chunks) + pageBytes - 1) / pageBytes
+    );
+    const dim_t chunkCount = (dim_t) ((bytes + chunkBytes - 1) / chunkBytes);
+
+    auto body = [&](const dim_t chunk) {
+      const udim_t offset = chunk * chunkBytes;
+      func(offset, std::min(chunkBytes, bytes - offset));
+    };
+    parallelFor(chunkCount, 1, parallelForChunk<decltype(body)>, &body);
+  }
+
+  void hostMemcpy(void *dest,
+                  const void *src,
+                  const udim_t bytes) {
+    if (bytes < hostCopy::parallelBytes) {
+      ::memcpy(dest, src, bytes);
+      return;
+    }
+    char *dest_ = (char*) dest;
+    const char *src_ = (const char*) src;
+    const bool nonTemporal = (bytes >= hostCopy::nonTemporalBytes);
+
+    forEachChunk(bytes, [&](const udim_t offset, const udim_t chunkBytes) {
+      if (nonTemporal) {
+        nonTemporalMemcpy(dest_ + offset, src_ + offset, chunkBytes);
+      } else {
+        ::memcpy(dest_ + offset, src_ + offset, chunkBytes);
+      }
+    });
+  }
+
+  void hostMemset(void *dest,
+                  const int value,
+                  const udim_t bytes) {
+    if (bytes < hostCopy::parallelBytes) {
+      ::memset(dest, value, bytes);
+      return;
+    }
+    char *dest_ = (char*) dest;
+    const bool nonTemporal = (bytes >= hostCopy::nonTemporalBytes);
+
+    forEachChunk(bytes, [&](const udim_t offset, const udim_t chunkBytes) {
+      if (nonTemporal) {
+        nonTemporalMemset(dest_ + offset, value, chunkBytes);
+      } else {
+        ::memset(dest_ + offset, value, chunkBytes);
+      }
+    });
+  }
+
+  void hostFirstTouch(void *ptr,
+                      const udim_t bytes) {
+    // Small allocations share pages with other allocations anyway
+    if (bytes < hostCopy::parallelBytes) {
+      return;
+    }
+    char *ptr_ = (char*) ptr;
+
+    forEachChunk(bytes, [&](const udim_t offset, const udim_t chunkBytes) {
+      volatile char *chunk = ptr_ + offset;
+      for (udim_t i = 0; i < chunkBytes; i += pageBytes) {
+        chunk[i] = 0;
+      }
+    });
+  }
+}
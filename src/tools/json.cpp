@@ -7,24 +7,77 @@
 namespace occa {
   const char json::objectKeyEndChars[] = " \t\r\n\v\f:";
 
-  json::~json() {}
+  json::~json() {
+    releaseValue();
+  }
 
   json& json::clear() {
-    type = none_;
-    value_.string = "";
-    value_.number = 0;
-    value_.object.clear();
-    value_.array.clear();
-    value_.boolean = false;
+    releaseValue();
     return *this;
   }
 
   json& json::operator = (const json &j) {
-    type = j.type;
-    value_ = j.value_;
+    // j could be a value inside of this json
+    const type_t newType = j.type;
+    jsonValue_t newValue = j.value_;
+
+    retainValue(newType, newValue);
+    releaseValue();
+
+    type = newType;
+    value_ = newValue;
     return *this;
   }
 
+  void json::releaseValue() {
+    switch (type) {
+    case number_: releaseShared(value_.number); break;
+    case string_: releaseShared(value_.string); break;
+    case array_:  releaseShared(value_.array);  break;
+    case object_: releaseShared(value_.object); break;
+    default: break;
+    }
+    type = none_;
+    value_.object = NULL;
+  }
+
+  void json::resetValue(const type_t type_) {
+    releaseValue();
+    type = type_;
+    if (type == boolean_) {
+      value_.boolean = false;
+    } else if (type == number_) {
+      value_.number = new jsonShared_t<primitive>(0);
+    }
+  }
+
+  const json* json::lookup(const char *c,
+                           const char escapeChar) const {
+    const json *j = this;
+    // Reuse the key buffer across path segments
+    std::string key;
+    while (*c != '\0') {
+      if (j->type != object_) {
+        return NULL;
+      }
+
+      const char *cStart = c;
+      lex::skipTo(c, '/', escapeChar);
+      key.assign(cStart, c - cStart);
+      if (*c == '/') {
+        ++c;
+      }
+
+      const jsonObject &obj = j->object();
+      jsonObject::const_iterator it = obj.find(key);
+      if (it == obj.end()) {
+        return NULL;
+      }
+      j = &(it->second);
+    }
+    return j;
+  }
+
   bool json::isInitialized() const {
     return (type != none_);
   }
@@ -81,14 +134,15 @@ namespace occa {
       break;
     }
     case number_: {
-      out += value_.number.toString();
+      out += number().toString();
       break;
     }
     case string_: {
+      const std::string &str = string();
       out += '"';
-      const int chars = (int) value_.string.size();
+      const int chars = (int) str.size();
       for (int i = 0; i < chars; ++i) {
-        const char c = value_.string[i];
+        const char c = str[i];
         switch (c) {
         case '"' : out += "\\\"";  break;
         case '\\': out += "\\\\";  break;
@@ -105,8 +159,9 @@ namespace occa {
       break;
     }
     case array_: {
+      const jsonArray &arr = array();
       out += '[';
-      const int arraySize = (int) value_.array.size();
+      const int arraySize = (int) arr.size();
       if (arraySize) {
         std::string newIndent = currentIndent + indent;
         if (indent.size()) {
@@ -114,7 +169,7 @@ namespace occa {
         }
         for (int i = 0; i < arraySize; ++i) {
           out += newIndent;
-          value_.array[i].dumpToString(out, indent, newIndent);
+          arr[i].dumpToString(out, indent, newIndent);
           if (i < (arraySize - 1)) {
             if (indent.size()) {
               out += ",\n";
@@ -131,18 +186,19 @@ namespace occa {
       break;
     }
     case object_: {
-      if (!value_.object.size()) {
+      const jsonObject &obj = object();
+      if (!obj.size()) {
         out += "{}";
         break;
       }
-      jsonObject::const_iterator it = value_.object.begin();
+      jsonObject::const_iterator it = obj.begin();
       out += '{';
-      if (it != value_.object.end()) {
+      if (it != obj.end()) {
         std::string newIndent = currentIndent + indent;
         if (indent.size()) {
           out += '\n';
         }
-        while (it != value_.object.end()) {
+        while (it != obj.end()) {
           const std::string &key = it->first;
           const json &value = it->second;
 
@@ -158,7 +214,7 @@ namespace occa {
           }
 
           ++it;
-          if (it != value_.object.end()) {
+          if (it != obj.end()) {
             if (indent.size()) {
               out += ",\n";
             } else {
@@ -203,7 +259,7 @@ namespace occa {
     // Skip quote
     const char quote = *c;
     ++c;
-    type = string_;
+    std::string &str = uniqueString();
 
     while (*c != '\0') {
       if (*c == '\\') {
@@ -214,29 +270,29 @@ namespace occa {
         switch (*c) {
           // Escape newline character
         case '\n': ++c; continue;
-        case 'b':  value_.string += '\b'; break;
-        case 'f':  value_.string += '\f'; break;
-        case 'n':  value_.string += '\n'; break;
-        case 'r':  value_.string += '\r'; break;
-        case 't':  value_.string += '\t'; break;
+        case 'b':  str += '\b'; break;
+        case 'f':  str += '\f'; break;
+        case 'n':  str += '\n'; break;
+        case 'r':  str += '\r'; break;
+        case 't':  str += '\t'; break;
         case 'u':
           // Found unicode character
           // Load \uXXXX
           ++c; // Skip 'u'
-          value_.string += "\\u";
+          str += "\\u";
           for (int i = 0; i < 4; ++i) {
             const char ci = c[i];
             OCCA_ERROR("Expected hex value",
                        (('0' <= ci) && (ci <= '9')) ||
                        (('a' <= ci) && (ci <= 'f')) ||
                        (('A' <= ci) && (ci <= 'F')));
-            value_.string += ci;
+            str += ci;
           }
           // Let the ++c increment the last character
           c += 3;
           break;
         default:
-          value_.string += *c;
+          str += *c;
         }
         // Skip the last used character
         ++c;
@@ -244,15 +300,14 @@ namespace occa {
         ++c;
         return;
       } else {
-        value_.string += *(c++);
+        str += *(c++);
       }
     }
     OCCA_FORCE_ERROR("Unclosed string");
   }
 
   void json::loadNumber(const char *&c) {
-    type = number_;
-    value_.number = primitive::load(c);
+    *this = primitive::load(c);
   }
 
   void json::loadObject(const char *&c) {
@@ -261,7 +316,7 @@ namespace occa {
     if (hasBrace) {
       ++c;
     }
-    type = object_;
+    asObject();
 
     while (*c != '\0') {
       lex::skipWhitespace(c);
@@ -300,7 +355,7 @@ namespace occa {
     if (*c == '"') {
       json jKey;
       jKey.loadString(c);
-      key = jKey.value_.string;
+      key = jKey.uniqueString();
     } else {
       const char *cStart = c;
       lex::skipTo(c, objectKeyEndChars);
@@ -313,13 +368,13 @@ namespace occa {
     OCCA_ERROR("Key must be followed by ':'",
                *c == ':');
     ++c;
-    value_.object[key].load(c);
+    uniqueObject()[key].load(c);
   }
 
   void json::loadArray(const char *&c) {
     // Skip [
     ++c;
-    type = array_;
+    asArray();
 
     while (*c != '\0') {
       lex::skipWhitespace(c);
@@ -329,8 +384,9 @@ namespace occa {
         return;
       }
 
-      value_.array.push_back(json());
-      value_.array[value_.array.size() - 1].load(c);
+      jsonArray &arr = uniqueArray();
+      arr.push_back(json());
+      arr.back().load(c);
       lex::skipWhitespace(c);
 
       if (*c == ',') {
@@ -351,23 +407,21 @@ namespace occa {
     OCCA_ERROR("Cannot read value: " << c,
                !strncmp(c, "true", 4));
     c += 4;
-    type = boolean_;
-    value_.boolean = true;
+    *this = true;
   }
 
   void json::loadFalse(const char *&c) {
     OCCA_ERROR("Cannot read value: " << c,
                !strncmp(c, "false", 5));
     c += 5;
-    type = boolean_;
-    value_.boolean = false;
+    *this = false;
   }
 
   void json::loadNull(const char *&c) {
     OCCA_ERROR("Cannot read value: " << c,
                !strncmp(c, "null", 4));
     c += 4;
-    type = null_;
+    asNull();
   }
 
   void json::loadComment(const char *&c) {
@@ -390,7 +444,10 @@ namespace occa {
 
     // We're not defined, treat this as an = operator
     if (type == none_) {
-      type = j.type;
+      if (j.type != array_) {
+        return (*this = j);
+      }
+      asArray();
     }
     OCCA_ERROR("Cannot apply operator + with different JSON types",
                (type == array_) ||
@@ -404,25 +461,29 @@ namespace occa {
       break;
     }
     case number_: {
-      primitive::addEq(value_.number, j.value_.number);
+      primitive::addEq(uniqueNumber(), j.number());
       break;
     }
     case string_: {
-      value_.string += j.value_.string;
+      uniqueString() += j.string();
       break;
     }
     case array_: {
-      value_.array.push_back(j);
+      // Hold a reference in case j is this array
+      const json value = j;
+      uniqueArray().push_back(value);
       break;
     }
     case object_: {
-      mergeWithObject(j.value_.object);
+      mergeWithObject(j);
       break;
     }}
     return *this;
   }
 
   void json::mergeWithObject(const jsonObject &obj) {
+    jsonObject &values = uniqueObject();
+
     jsonObject::const_iterator it = obj.begin();
     while (it != obj.end()) {
       const std::string &key = it->first;
@@ -430,44 +491,34 @@ namespace occa {
       ++it;
 
       // If we're merging two json objects, recursively merge them
-      if (val.isObject() && has(key)) {
-        // Reuse prefetch
-        json &oldVal = value_.object[key];
-        if (oldVal.isObject()) {
-          oldVal += val;
-        } else {
-          oldVal = val;
+      if (val.isObject()) {
+        jsonObject::iterator oldIt = values.find(key);
+        if ((oldIt != values.end()) &&
+            oldIt->second.isObject()) {
+          oldIt->second.mergeWithObject(val);
+          continue;
         }
-      } else {
-        value_.object[key] = val;
       }
+      values[key] = val;
     }
   }
 
-  bool json::has(const std::string &s) const {
-    const char *c  = s.c_str();
-    const json *j = this;
-
-    while (*c != '\0') {
-      if (j->type != object_) {
-        return false;
-      }
-
-      const char *cStart = c;
-      lex::skipTo(c, '/', '\\');
-
-      std::string key(cStart, c - cStart);
-      if (*c == '/') {
-        ++c;
-      }
-
-      jsonObject::const_iterator it = j->value_.object.find(key);
-      if (it == j->value_.object.end()) {
-        return false;
-      }
-      j = &(it->second);
+  void json::mergeWithObject(const json &j) {
+    if (!j.isObject()) {
+      return;
+    }
+    // Share the object if there is nothing to merge with
+    const json &self = *this;
+    if ((type == none_) ||
+        ((type == object_) && !self.object().size())) {
+      *this = j;
+      return;
     }
-    return true;
+    mergeWithObject(j.object());
+  }
+
+  bool json::has(const std::string &s) const {
+    return lookup(s.c_str(), '\\') != NULL;
   }
 
   json& json::operator [] (const char *c) {
@@ -475,77 +526,52 @@ namespace occa {
     const char *c0 = c;
 #endif
     json *j = this;
-    bool exists = true;
-
-    if (type == none_) {
-      type = object_;
-      exists = false;
-    }
+    std::string key;
 
     while (*c != '\0') {
+      // Missing parent paths become objects
+      if (j->type == none_) {
+        j->asObject();
+      }
       OCCA_ERROR("Path '" << std::string(c0, c - c0) << "' is not an object",
                  j->type == object_);
 
       const char *cStart = c;
       lex::skipTo(c, '/', '\\');
-      std::string key(cStart, c - cStart);
+      key.assign(cStart, c - cStart);
       if (*c == '/') {
         ++c;
       }
 
-      j = &(j->value_.object[key]);
-      if (j->type == none_) {
-        j->type = object_;
-        exists = false;
-      }
-    }
-    if (!exists) {
-      j->type = none_;
+      j = &(j->object()[key]);
     }
     return *j;
   }
 
   const json& json::operator [] (const char *c) const {
     static json default_;
-    const json *j = this;
-    while (*c != '\0') {
-      if (j->type != object_) {
-        return default_;
-      }
-
-      const char *cStart = c;
-      lex::skipTo(c, '/', '\\');
-      std::string key(cStart, c - cStart);
-      if (*c == '/') {
-        ++c;
-      }
-
-      jsonObject::const_iterator it = j->value_.object.find(key);
-      if (it == j->value_.object.end()) {
-        return default_;
-      }
-      j = &(it->second);
-    }
-    return *j;
+    const json *j = lookup(c, '\\');
+    return j ? *j : default_;
   }
 
   json& json::operator [] (const int n) {
     OCCA_ERROR("Can only apply operator [] with JSON arrays",
                type == array_);
-    const int arraySize = (int) value_.array.size();
+    jsonArray &arr = array();
+    const int arraySize = (int) arr.size();
     if (arraySize <= n) {
-      value_.array.resize(n + 1);
+      arr.resize(n + 1);
       for (int i = arraySize; i < n; ++i) {
-        value_.array[i].asNull();
+        arr[i].asNull();
       }
     }
-    return value_.array[n];
+    return arr[n];
   }
 
   const json& json::operator [] (const int n) const {
     OCCA_ERROR("Can only apply operator [] with JSON arrays",
                type == array_);
-    return value_.array[n];
+    return array()[n];
   }
 
   int json::size() const {
@@ -563,54 +589,138 @@ namespace occa {
       return 0;
     }
     case string_: {
-      return (int) value_.string.size();
+      return (int) string().size();
     }
     case array_: {
-      return (int) value_.array.size();
+      return (int) array().size();
     }
     case object_: {
-      return (int) value_.object.size();
+      return (int) object().size();
     }}
     return 0;
   }
 
   json& json::remove(const char *c) {
+    // Avoid copying shared values if there is nothing to remove
+    if (!lookup(c, '\\')) {
+      return *this;
+    }
+
     json *j = this;
+    std::string key;
     while (*c != '\0') {
-      if (j->type != object_) {
-        return *this;
-      }
-
       const char *cStart = c;
       lex::skipTo(c, '/', '\\');
-      std::string key(cStart, c - cStart);
+      key.assign(cStart, c - cStart);
       if (*c == '/') {
         ++c;
       }
 
+      jsonObject &obj = j->uniqueObject();
       if (*c == '\0') {
-        j->value_.object.erase(key);
-        return *this;
-      }
-
-      jsonObject::iterator it = j->value_.object.find(key);
-      if (it == j->value_.object.end()) {
+        obj.erase(key);
         return *this;
       }
-      j = &(it->second);
+      j = &(obj[key]);
     }
     return *this;
   }
 
+  template <class TM>
+  hash_t json::cachedHash(jsonShared_t<TM> *shared) const {
+    // Values with mutable references can change without resetting
+    //   the cached hash, e.g. through a reference to one of their entries
+    if (!shared || shared->hasMutableRefs) {
+      return computeHash();
+    }
+    if (shared->hashState.load(std::memory_order_acquire) == jsonHashState::ready) {
+      return shared->hash;
+    }
+
+    const hash_t hash_ = computeHash();
+
+    // Only one thread stores the hash if the value is hashed concurrently
+    int state = jsonHashState::none;
+    if (shared->hashState.compare_exchange_strong(state,
+                                                  jsonHashState::computing)) {
+      shared->hash = hash_;
+      shared->hashState.store(jsonHashState::ready,
+                              std::memory_order_release);
+    }
+    return hash_;
+  }
+
   hash_t json::hash() const {
-    std::string out;
-    dumpToString(out);
-    return occa::hash(out);
+    switch (type) {
+    case number_: return cachedHash(value_.number);
+    case string_: return cachedHash(value_.string);
+    case array_:  return cachedHash(value_.array);
+    case object_: return cachedHash(value_.object);
+    default:
+      return computeHash();
+    }
+  }
+
+  hash_t json::computeHash() const {
+    hasher_t hasher;
+
+    const char typeTag = (char) type;
+    hasher.update(&typeTag, sizeof(typeTag));
+
+    switch (type) {
+    case none_: break;
+    case null_: break;
+    case boolean_: {
+      const char value = value_.boolean;
+      hasher.update(&value, sizeof(value));
+      break;
+    }
+    case number_: {
+      hasher.update(number().toString());
+      break;
+    }
+    case string_: {
+      const std::string &str = string();
+      const udim_t chars = str.size();
+      hasher.update(&chars, sizeof(chars));
+      hasher.update(str);
+      break;
+    }
+    case array_: {
+      const jsonArray &arr = array();
+      const udim_t entries = arr.size();
+      hasher.update(&entries, sizeof(entries));
+      for (udim_t i = 0; i < entries; ++i) {
+        const hash_t entryHash = arr[i].hash();
+        hasher.update(entryHash.h, sizeof(entryHash.h));
+      }
+      break;
+    }
+    case object_: {
+      const jsonObject &obj = object();
+      const udim_t entries = obj.size();
+      hasher.update(&entries, sizeof(entries));
+
+      jsonObject::const_iterator it = obj.begin();
+      while (it != obj.end()) {
+        const std::string &key = it->first;
+        const udim_t keyChars = key.size();
+        hasher.update(&keyChars, sizeof(keyChars));
+        hasher.update(key);
+
+        const hash_t valueHash = it->second.hash();
+        hasher.update(valueHash.h, sizeof(valueHash.h));
+        ++it;
+      }
+      break;
+    }}
+
+    return hasher.digest();
   }
 
   std::string json::toString() const {
     if (type == string_) {
-      return value_.string;
+      return string();
     }
     return dump();
   }
@@ -618,7 +728,7 @@ namespace occa {
   strVector json::keys() const {
     strVector vec;
     if (type == object_) {
-      const jsonObject &obj = value_.object;
+      const jsonObject &obj = object();
       jsonObject::const_iterator it = obj.begin();
       while (it != obj.end()) {
         vec.push_back(it->first);
@@ -631,7 +741,7 @@ namespace occa {
   jsonArray json::values() const {
     jsonArray vec;
     if (type == object_) {
-      const jsonObject &obj = value_.object;
+      const jsonObject &obj = object();
       jsonObject::const_iterator it = obj.begin();
       while (it != obj.end()) {
         vec.push_back(it->second);
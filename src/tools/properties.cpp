@@ -3,23 +3,22 @@
 #include <occa/tools/string.hpp>
 
 namespace occa {
-  properties::properties() {
-    type = object_;
-    initialized = false;
-  }
+  properties::properties() :
+      json(object_),
+      initialized(false) {}
 
-  properties::properties(const properties &other) : json() {
-    type = object_;
-    value_ = other.value_;
+  properties::properties(const properties &other) :
+      json(other) {
+    asObject();
 
     // Note: "other" might be a json object
     initialized = other.isInitialized();
   }
 
-  properties::properties(const json &j) {
-    type = object_;
-    value_ = j.value_;
-    initialized = true;
+  properties::properties(const json &j) :
+      json(j),
+      initialized(true) {
+    asObject();
   }
 
   properties::properties(const char *c) :
@@ -42,7 +41,7 @@ namespace occa {
 
   bool properties::isInitialized() const {
     if (!initialized) {
-      initialized = value_.object.size();
+      initialized = object().size();
     }
     return initialized;
   }
@@ -786,6 +786,21 @@ namespace occa {
       return "";
     }
 
+    std::string compilerOpenMPSimdFlags(const std::string &compiler) {
+      return compilerOpenMPSimdFlags( sys::compilerVendor(compiler) );
+    }
+
+    std::string compilerOpenMPSimdFlags(const int vendor_) {
+      // Enables "#pragma omp simd" without the OpenMP runtime
+      if (vendor_ & (sys::vendor::GNU |
+                     sys::vendor::LLVM)) {
+        return "-fopenmp-simd";
+      } else if (vendor_ & sys::vendor::Intel) {
+        return "-qopenmp-simd";
+      }
+      return "";
+    }
+
     void addCompilerIncludeFlags(std::string &compilerFlags) {
       strVector includeDirs = env::OCCA_INCLUDE_PATH;
 
@@ -829,10 +844,18 @@ namespace occa {
 
     //---[ Dynamic Methods ]------------
     void* malloc(udim_t bytes) {
-      void* ptr;
+      return sys::malloc(bytes, env::OCCA_MEM_BYTE_ALIGN);
+    }
+
+    void* malloc(udim_t bytes, const udim_t alignment) {
+      void* ptr = NULL;
 
 #if   (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      ignoreResult( posix_memalign(&ptr, env::OCCA_MEM_BYTE_ALIGN, bytes) );
+      OCCA_ERROR("Memory alignment [" << alignment << "] must be a power of two"
+                 " and a multiple of sizeof(void*)",
+                 (alignment >= sizeof(void*))
+                 && ((alignment & (alignment - 1)) == 0));
+      ignoreResult( posix_memalign(&ptr, alignment, bytes) );
 #elif (OCCA_OS == OCCA_WINDOWS_OS)
       ptr = ::malloc(bytes);
 #endif
@@ -904,6 +927,27 @@ namespace occa {
       return sym2;
     }
 
+    functionPtr_t tryDlsym(void *dlHandle,
+                           const std::string &functionName) {
+      if (!dlHandle) {
+        return NULL;
+      }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      void *sym = ::dlsym(dlHandle, functionName.c_str());
+      if (!sym) {
+        // Clear the error so it doesn't show up in a later dlerror()
+        dlerror();
+      }
+#else
+      void *sym = GetProcAddress((HMODULE) dlHandle, functionName.c_str());
+#endif
+
+      functionPtr_t sym2;
+      ::memcpy(&sym2, &sym, sizeof(sym));
+      return sym2;
+    }
+
     void dlclose(void *dlHandle) {
       if (!dlHandle) {
         return;
@@ -0,0 +1,95 @@
+#include <algorithm>
+
+#include <occa/tools/sys.hpp>
+#include <occa/tools/threadPool.hpp>
+
+namespace occa {
+  threadPool::threadPool(const int threadCount) :
+    runningJobs(0),
+    stopping(false) {
+
+    const int threads = (
+      (threadCount > 0)
+      ? threadCount
+      : defaultThreadCount()
+    );
+
+    workers.reserve(threads);
+    for (int i = 0; i < threads; ++i) {
+      workers.push_back(
+        std::thread(&threadPool::workerLoop, this)
+      );
+    }
+  }
+
+  threadPool::~threadPool() {
+    {
+      std::unique_lock<std::mutex> guard(jobMutex);
+      stopping = true;
+    }
+    jobAdded.notify_all();
+
+    const int threads = (int) workers.size();
+    for (int i = 0; i < threads; ++i) {
+      workers[i].join();
+    }
+  }
+
+  int threadPool::size() const {
+    return (int) workers.size();
+  }
+
+  int threadPool::pendingJobs() {
+    std::unique_lock<std::mutex> guard(jobMutex);
+    return (int) jobs.size() + runningJobs;
+  }
+
+  void threadPool::push(const job_t &job) {
+    {
+      std::unique_lock<std::mutex> guard(jobMutex);
+      jobs.push_back(job);
+    }
+    jobAdded.notify_one();
+  }
+
+  void threadPool::wait() {
+    std::unique_lock<std::mutex> guard(jobMutex);
+    while (jobs.size() || runningJobs) {
+      jobsFinished.wait(guard);
+    }
+  }
+
+  int threadPool::defaultThreadCount() {
+    const int cores = (int) std::thread::hardware_concurrency();
+    if (cores > 0) {
+      return cores;
+    }
+    return std::max(1, sys::getCoreCount());
+  }
+
+  void threadPool::workerLoop() {
+    std::unique_lock<std::mutex> guard(jobMutex);
+    while (true) {
+      while (!stopping && !jobs.size()) {
+        jobAdded.wait(guard);
+      }
+      // Drain the queue before stopping
+      if (!jobs.size()) {
+        return;
+      }
+
+      job_t job = jobs.front();
+      jobs.pop_front();
+      ++runningJobs;
+
+      guard.unlock();
+      job();
+      guard.lock();
+
+      --runningJobs;
+      if (!jobs.size() && !runningJobs) {
+        jobsFinished.notify_all();
+      }
+    }
+  }
+}
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <map>
+#include <thread>
 
 #include <occa/core/base.hpp>
 #include <occa/tools/misc.hpp>
@@ -6,8 +8,7 @@
 #include <occa/tools/uva.hpp>
 
 namespace occa {
-  ptrRangeMap uvaMap;
-  memoryVector uvaStaleMemory;
+  ptrRangeIndex uvaMap;
 
   //---[ ptrRange ]---------------------
   ptrRange::ptrRange() :
@@ -53,13 +54,264 @@ namespace occa {
   //====================================
 
 
-  //---[ UVA ]--------------------------
-  occa::modeMemory_t* uvaToMemory(void *ptr) {
+  //---[ ptrRangeIndex ]----------------
+  ptrRangeIndex::shard_t::shard_t() :
+    lockState(0) {}
+
+  void ptrRangeIndex::shard_t::readLock() {
+    while (true) {
+      int state = lockState.load();
+      if ((state >= 0)
+          && lockState.compare_exchange_weak(state, state + 1)) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  void ptrRangeIndex::shard_t::readUnlock() {
+    --lockState;
+  }
+
+  void ptrRangeIndex::shard_t::writeLock() {
+    while (true) {
+      int state = 0;
+      if (lockState.compare_exchange_weak(state, -1)) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  void ptrRangeIndex::shard_t::writeUnlock() {
+    lockState.store(0);
+  }
+
+  ptrRangeIndex::shard_t& ptrRangeIndex::getShard(const char *ptr) {
+    const size_t chunk = (((size_t) ptr) >> chunkShift);
+    return shards[chunk % shardCount];
+  }
+
+  void ptrRangeIndex::insert(const ptrRange &range,
+                             modeMemory_t *mem) {
+    // Ranges covering more than [shardCount] chunks are in every shard
+    const size_t startChunk = (((size_t) range.start) >> chunkShift);
+    const size_t endChunk = (range.end > range.start)
+      ? ((((size_t) range.end) - 1) >> chunkShift)
+      : startChunk;
+
+    for (size_t chunk = startChunk;
+         (chunk <= endChunk) && (chunk < (startChunk + shardCount));
+         ++chunk) {
+      shard_t &shard = shards[chunk % shardCount];
+      shard.writeLock();
+      shard.ranges[range] = mem;
+      shard.writeUnlock();
+    }
+  }
+
+  void ptrRangeIndex::erase(void *ptr) {
+    shard_t &shard = getShard((char*) ptr);
+
+    shard.readLock();
+    ptrRangeMap::iterator it = shard.ranges.find(ptr);
+    const bool found = (it != shard.ranges.end());
+    const ptrRange range = found ? it->first : ptrRange();
+    shard.readUnlock();
+
+    if (found) {
+      eraseRange(range);
+    }
+  }
+
+  void ptrRangeIndex::eraseRange(const ptrRange &range) {
+    const size_t startChunk = (((size_t) range.start) >> chunkShift);
+    const size_t endChunk = (range.end > range.start)
+      ? ((((size_t) range.end) - 1) >> chunkShift)
+      : startChunk;
+
+    for (size_t chunk = startChunk;
+         (chunk <= endChunk) && (chunk < (startChunk + shardCount));
+         ++chunk) {
+      shard_t &shard = shards[chunk % shardCount];
+      shard.writeLock();
+      shard.ranges.erase(range);
+      shard.writeUnlock();
+    }
+  }
+
+  modeMemory_t* ptrRangeIndex::find(const void *ptr) {
     if (!ptr) {
       return NULL;
     }
-    ptrRangeMap::iterator it = uvaMap.find(ptr);
-    return (it == uvaMap.end()) ? NULL : it->second;
+    shard_t &shard = getShard((const char*) ptr);
+
+    shard.readLock();
+    ptrRangeMap::iterator it = shard.ranges.find(const_cast<void*>(ptr));
+    modeMemory_t *mem = ((it != shard.ranges.end())
+                         ? it->second
+                         : NULL);
+    shard.readUnlock();
+
+    return mem;
+  }
+  //====================================
+
+
+  //---[ dirtyRangeSet ]---------------
+  bool dirtyRangeSet::isEmpty() const {
+    return ranges.empty();
+  }
+
+  int dirtyRangeSet::rangeCount() const {
+    return (int) ranges.size();
+  }
+
+  udim_t dirtyRangeSet::bytes() const {
+    udim_t bytes_ = 0;
+    std::map<udim_t, udim_t>::const_iterator it = ranges.begin();
+    while (it != ranges.end()) {
+      bytes_ += (it->second - it->first);
+      ++it;
+    }
+    return bytes_;
+  }
+
+  void dirtyRangeSet::add(const udim_t offset,
+                          const udim_t bytes_) {
+    if (!bytes_) {
+      return;
+    }
+    udim_t start = offset;
+    udim_t end = offset + bytes_;
+
+    // Merge with a range ending at or after [start]
+    std::map<udim_t, udim_t>::iterator it = ranges.upper_bound(start);
+    if (it != ranges.begin()) {
+      std::map<udim_t, udim_t>::iterator prev = it;
+      --prev;
+      if (start <= prev->second) {
+        start = prev->first;
+        end = std::max(end, prev->second);
+        it = prev;
+      }
+    }
+    // Merge with ranges starting at or before [end]
+    while ((it != ranges.end()) && (it->first <= end)) {
+      end = std::max(end, it->second);
+      ranges.erase(it++);
+    }
+    ranges[start] = end;
+  }
+
+  void dirtyRangeSet::take(const udim_t offset,
+                           const udim_t bytes_,
+                           rangeVector &taken) {
+    const udim_t start = offset;
+    const udim_t end = offset + bytes_;
+
+    std::map<udim_t, udim_t>::iterator it = ranges.upper_bound(start);
+    if (it != ranges.begin()) {
+      --it;
+      if (it->second <= start) {
+        ++it;
+      }
+    }
+    while ((it != ranges.end()) && (it->first < end)) {
+      const udim_t rangeStart = it->first;
+      const udim_t rangeEnd = it->second;
+      ranges.erase(it++);
+
+      // Keep the parts outside of [start, end)
+      if (rangeStart < start) {
+        ranges[rangeStart] = start;
+      }
+      if (end < rangeEnd) {
+        ranges[end] = rangeEnd;
+      }
+      taken.push_back(range_t(std::max(rangeStart, start),
+                              std::min(rangeEnd, end)));
+    }
+  }
+
+  void dirtyRangeSet::clear() {
+    ranges.clear();
+  }
+  //====================================
+
+
+  //---[ staleMemoryList ]--------------
+  staleMemoryList::staleMemoryList() :
+    head(NULL) {}
+
+  staleMemoryList::~staleMemoryList() {
+    listMutex.free();
+  }
+
+  bool staleMemoryList::isEmpty() const {
+    listMutex.lock();
+    const bool empty = (head == NULL);
+    listMutex.unlock();
+    return empty;
+  }
+
+  bool staleMemoryList::contains(const modeMemory_t *mem) const {
+    listMutex.lock();
+    const bool found = (mem->prevStale || (head == mem));
+    listMutex.unlock();
+    return found;
+  }
+
+  void staleMemoryList::push(modeMemory_t *mem) {
+    listMutex.lock();
+    if (!mem->prevStale && (head != mem)) {
+      mem->nextStale = head;
+      if (head) {
+        head->prevStale = mem;
+      }
+      head = mem;
+    }
+    listMutex.unlock();
+  }
+
+  void staleMemoryList::remove(modeMemory_t *mem) {
+    listMutex.lock();
+    if (mem->prevStale) {
+      mem->prevStale->nextStale = mem->nextStale;
+    } else if (head == mem) {
+      head = mem->nextStale;
+    } else {
+      // Not in the list
+      listMutex.unlock();
+      return;
+    }
+    if (mem->nextStale) {
+      mem->nextStale->prevStale = mem->prevStale;
+    }
+    mem->prevStale = NULL;
+    mem->nextStale = NULL;
+    listMutex.unlock();
+  }
+
+  modeMemory_t* staleMemoryList::pop() {
+    listMutex.lock();
+    modeMemory_t *mem = head;
+    if (mem) {
+      head = mem->nextStale;
+      if (head) {
+        head->prevStale = NULL;
+      }
+      mem->nextStale = NULL;
+    }
+    listMutex.unlock();
+    return mem;
+  }
+  //====================================
+
+
+  //---[ UVA ]--------------------------
+  occa::modeMemory_t* uvaToMemory(void *ptr) {
+    return uvaMap.find(ptr);
   }
 
   bool isManaged(void *ptr) {
@@ -137,33 +389,26 @@ namespace occa {
   }
 
   void removeFromStaleMap(void *ptr) {
-    ptrRangeMap::iterator it = uvaMap.find(ptr);
-    if (it == uvaMap.end()) {
-      return;
-    }
-
-    memory m(it->second);
-    if (!m.uvaIsStale()) {
-      return;
+    modeMemory_t *mem = uvaToMemory(ptr);
+    if (mem && mem->isStale()) {
+      removeFromStaleMap(mem);
     }
-
-    removeFromStaleMap(m.getModeMemory());
   }
 
   void removeFromStaleMap(modeMemory_t *mem) {
     if (!mem) {
       return;
     }
+    mem->memInfo &= ~uvaFlag::isStale;
+    mem->modeDevice->uvaStaleMemory.remove(mem);
+  }
 
-    occa::memory m(mem);
-    const size_t staleEntries = uvaStaleMemory.size();
-
-    for (size_t i = 0; i < staleEntries; ++i) {
-      if (uvaStaleMemory[i] == mem) {
-        m.uvaMarkFresh();
-        uvaStaleMemory.erase(uvaStaleMemory.begin() + i);
-        break;
-      }
+  void markDirty(void *ptr, const udim_t bytes) {
+    occa::modeMemory_t *mem = uvaToMemory(ptr);
+    if (mem) {
+      const udim_t offset = ptrDiff(mem->uvaPtr, ptr);
+      mem->markHostDirty(offset,
+                         std::min(bytes, mem->size - offset));
     }
   }
 
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <cstdlib>
+
+#include <occa/tools/threadPool.hpp>
+#include <occa/tools/workStealingPool.hpp>
+
+namespace occa {
+  // Nested parallelFor calls run inline
+  static thread_local bool inParallelFor = false;
+
+  workStealingPool::workStealingPool(const int threadCount) :
+    generation(0),
+    busyWorkers(0),
+    stopping(false),
+    runChunk(NULL),
+    body(NULL),
+    chunkSize(1) {
+
+    const int threads = (
+      (threadCount > 0)
+      ? threadCount
+      : defaultThreadCount()
+    );
+
+    ranges.resize(threads);
+    for (int i = 0; i < threads; ++i) {
+      ranges[i] = new workRange_t();
+      ranges[i]->begin = 0;
+      ranges[i]->end = 0;
+    }
+
+    // The thread calling parallelFor takes the first range
+    workers.reserve(threads - 1);
+    for (int i = 1; i < threads; ++i) {
+      workers.push_back(
+        std::thread(&workStealingPool::workerLoop, this, i)
+      );
+    }
+  }
+
+  workStealingPool::~workStealingPool() {
+    {
+      std::unique_lock<std::mutex> guard(stateMutex);
+      stopping = true;
+    }
+    workAdded.notify_all();
+
+    const int workerCount = (int) workers.size();
+    for (int i = 0; i < workerCount; ++i) {
+      workers[i].join();
+    }
+
+    const int rangeCount = (int) ranges.size();
+    for (int i = 0; i < rangeCount; ++i) {
+      delete ranges[i];
+    }
+  }
+
+  int workStealingPool::size() const {
+    return (int) ranges.size();
+  }
+
+  void workStealingPool::parallelFor(const dim_t iterations,
+                                     const dim_t chunkSize_,
+                                     parallelForChunk_t runChunk_,
+                                     void *body_) {
+    if (iterations <= 0) {
+      return;
+    }
+
+    const int threads = size();
+    const dim_t chunk = (
+      (chunkSize_ > 0)
+      ? chunkSize_
+      // Leave enough chunks for stealing to balance the load
+      : std::max((dim_t) 1, iterations / (8 * threads))
+    );
+
+    if ((threads == 1) || (iterations <= chunk) || inParallelFor) {
+      runChunk_(body_, 0, iterations);
+      return;
+    }
+
+    std::unique_lock<std::mutex> dispatchGuard(dispatchMutex);
+
+    runChunk = runChunk_;
+    body = body_;
+    chunkSize = chunk;
+
+    // Split the iterations evenly between threads
+    const dim_t share = iterations / threads;
+    const dim_t remainder = iterations % threads;
+    dim_t begin = 0;
+    for (int i = 0; i < threads; ++i) {
+      const dim_t end = begin + share + (i < remainder);
+      std::unique_lock<std::mutex> rangeGuard(ranges[i]->mutex);
+      ranges[i]->begin = begin;
+      ranges[i]->end = end;
+      begin = end;
+    }
+
+    {
+      std::unique_lock<std::mutex> guard(stateMutex);
+      ++generation;
+      busyWorkers = threads - 1;
+    }
+    workAdded.notify_all();
+
+    runRanges(0);
+
+    std::unique_lock<std::mutex> guard(stateMutex);
+    while (busyWorkers) {
+      workFinished.wait(guard);
+    }
+  }
+
+  int workStealingPool::defaultThreadCount() {
+    const char *ompThreads = getenv("OMP_NUM_THREADS");
+    if (ompThreads) {
+      const int threads = atoi(ompThreads);
+      if (threads > 0) {
+        return threads;
+      }
+    }
+    return threadPool::defaultThreadCount();
+  }
+
+  void workStealingPool::workerLoop(const int id) {
+    udim_t lastGeneration = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> guard(stateMutex);
+        while (!stopping && (generation == lastGeneration)) {
+          workAdded.wait(guard);
+        }
+        if (stopping) {
+          return;
+        }
+        lastGeneration = generation;
+      }
+
+      runRanges(id);
+
+      bool lastWorker;
+      {
+        std::unique_lock<std::mutex> guard(stateMutex);
+        lastWorker = !(--busyWorkers);
+      }
+      if (lastWorker) {
+        workFinished.notify_all();
+      }
+    }
+  }
+
+  void workStealingPool::runRanges(const int id) {
+    workRange_t &range = *(ranges[id]);
+    inParallelFor = true;
+    do {
+      while (true) {
+        dim_t begin, end;
+        {
+          std::unique_lock<std::mutex> guard(range.mutex);
+          if (range.begin >= range.end) {
+            break;
+          }
+          begin = range.begin;
+          end = std::min(begin + chunkSize, range.end);
+          range.begin = end;
+        }
+        runChunk(body, begin, end);
+      }
+    } while (stealRange(id));
+    inParallelFor = false;
+  }
+
+  bool workStealingPool::stealRange(const int id) {
+    const int threads = size();
+    for (int i = 1; i < threads; ++i) {
+      workRange_t &victim = *(ranges[(id + i) % threads]);
+
+      dim_t begin, end;
+      {
+        std::unique_lock<std::mutex> guard(victim.mutex);
+        const dim_t remaining = victim.end - victim.begin;
+        if (remaining <= 0) {
+          continue;
+        }
+        // Take the back half, leaving the victim its next chunk
+        const dim_t stolen = std::max(std::min(chunkSize, remaining),
+                                      remaining / 2);
+        end = victim.end;
+        begin = end - stolen;
+        victim.end = begin;
+      }
+
+      workRange_t &range = *(ranges[id]);
+      std::unique_lock<std::mutex> guard(range.mutex);
+      range.begin = begin;
+      range.end = end;
+      return true;
+    }
+    return false;
+  }
+
+  workStealingPool& getHostThreadPool() {
+    static workStealingPool pool;
+    return pool;
+  }
+
+  void parallelFor(const dim_t iterations,
+                   const dim_t chunkSize,
+                   parallelForChunk_t runChunk,
+                   void *body) {
+    getHostThreadPool().parallelFor(iterations,
+                                    chunkSize,
+                                    runChunk,
+                                    body);
+  }
+}
@@ -0,0 +1,82 @@
+#include <cstdlib>
+
+#include <occa.hpp>
+
+// Hashes a large kernel source with the previous byte-at-a-time
+//   hash and the current occa::hash
+//
+// Usage: benchmark-hash [megabytes=64] [iterations=5]
+
+occa::hash_t legacyHash(const void *ptr, occa::udim_t bytes) {
+  const char *c = (const char*) ptr;
+
+  occa::hash_t hash;
+  int *h = hash.h;
+
+  const int p[8] = {
+    102679, 102701, 102761, 102763,
+    102769, 102793, 102797, 102811
+  };
+
+  for (occa::udim_t i = 0; i < bytes; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      h[j] = (h[j] * p[j]) ^ c[i];
+    }
+  }
+  hash.initialized = true;
+
+  return hash;
+}
+
+std::string getKernelSource(const occa::udim_t bytes) {
+  const std::string kernel = occa::io::read(
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+  );
+
+  std::string source;
+  source.reserve(bytes + kernel.size());
+  while (source.size() < bytes) {
+    source += kernel;
+  }
+  source.resize(bytes);
+  return source;
+}
+
+template <class hashFunction>
+double timeHash(hashFunction func,
+                const std::string &source,
+                const int iterations) {
+  // Keep the result around so the hash isn't optimized out
+  int checksum = 0;
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    checksum ^= func(source.c_str(), source.size()).h[0];
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  if (checksum == 1) {
+    std::cout << ' ';
+  }
+  return elapsed / iterations;
+}
+
+int main(const int argc, const char **argv) {
+  const int megabytes = (argc > 1) ? atoi(argv[1]) : 64;
+  const int iterations = (argc > 2) ? atoi(argv[2]) : 5;
+
+  const occa::udim_t bytes = (occa::udim_t) megabytes << 20;
+  const std::string source = getKernelSource(bytes);
+
+  const double legacyTime = timeHash(legacyHash, source, iterations);
+  const double newTime = timeHash(
+    (occa::hash_t (*)(const void*, occa::udim_t)) occa::hash,
+    source,
+    iterations
+  );
+
+  std::cout << "Source size: " << megabytes << " MB\n"
+            << "Legacy hash: " << (megabytes / legacyTime) << " MB/s\n"
+            << "occa::hash:  " << (megabytes / newTime) << " MB/s\n"
+            << "Speedup:     " << (legacyTime / newTime) << "x\n";
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <cstdlib>
+#include <cstring>
+
+#include <occa.hpp>
+
+// Host copy and fill bandwidth, single-threaded ::memcpy / ::memset
+//   against the host copy engine and against OpenMP-mode memory copies
+//
+// Usage: benchmark-hostCopy [megabytes=256] [iterations=10]
+
+static char *src, *dest;
+static occa::udim_t bytes;
+
+void runMemcpy() {
+  ::memcpy(dest, src, bytes);
+}
+
+void runHostMemcpy() {
+  occa::hostMemcpy(dest, src, bytes);
+}
+
+void runMemset() {
+  ::memset(dest, 1, bytes);
+}
+
+void runHostMemset() {
+  occa::hostMemset(dest, 1, bytes);
+}
+
+static occa::memory serialMem, openmpMem;
+
+void runSerialCopyFrom() {
+  serialMem.copyFrom(src);
+}
+
+void runOpenMPCopyFrom() {
+  openmpMem.copyFrom(src);
+}
+
+// Returns GB/s, copies count the read and the write
+template <class func_t>
+double bandwidth(func_t func,
+                 const int iterations,
+                 const int bytesMoved) {
+  // Warm up and fault in the pages
+  func();
+
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    func();
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  return (bytesMoved * (double) bytes * iterations) / (1e9 * elapsed);
+}
+
+int main(int argc, char **argv) {
+  const int megabytes = (argc > 1) ? ::atoi(argv[1]) : 256;
+  const int iterations = (argc > 2) ? ::atoi(argv[2]) : 10;
+
+  bytes = ((occa::udim_t) megabytes) << 20;
+  src  = (char*) occa::sys::malloc(bytes);
+  dest = (char*) occa::sys::malloc(bytes);
+  occa::hostFirstTouch(src, bytes);
+  occa::hostFirstTouch(dest, bytes);
+  ::memset(src, 2, bytes);
+
+  std::cout << "Host threads: " << occa::getHostThreadPool().size() << '\n'
+            << "memcpy:              " << bandwidth(runMemcpy, iterations, 2) << " GB/s\n"
+            << "hostMemcpy:          " << bandwidth(runHostMemcpy, iterations, 2) << " GB/s\n"
+            << "memset:              " << bandwidth(runMemset, iterations, 1) << " GB/s\n"
+            << "hostMemset:          " << bandwidth(runHostMemset, iterations, 1) << " GB/s\n";
+
+  occa::device serialDevice("mode: 'Serial'");
+  serialMem = serialDevice.malloc(bytes);
+  std::cout << "Serial copyFrom:     " << bandwidth(runSerialCopyFrom, iterations, 2) << " GB/s\n";
+
+  if (occa::modeIsEnabled("OpenMP")) {
+    occa::device openmpDevice("mode: 'OpenMP'");
+    openmpMem = openmpDevice.malloc(bytes);
+    std::cout << "OpenMP copyFrom:     " << bandwidth(runOpenMPCopyFrom, iterations, 2) << " GB/s\n";
+    openmpMem.free();
+  }
+  serialMem.free();
+
+  occa::sys::free(src);
+  occa::sys::free(dest);
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <cstdlib>
+
+#include <occa.hpp>
+
+// Times the occa::properties operations used while setting up kernels
+//
+// Usage: benchmark-json [iterations=100000]
+
+occa::properties getKernelProperties() {
+  occa::properties props(
+    "mode: 'Serial',"
+    "kernel: {"
+    "  compiler: 'g++',"
+    "  compiler_flags: '-O3 -fopenmp',"
+    "  compiler_language: 'C++',"
+    "  simd: { enabled: true },"
+    "  verbose: false,"
+    "},"
+    "okl: {"
+    "  enabled: true,"
+    "  validate: true,"
+    "  include_paths: ['/usr/include', '/usr/local/include'],"
+    "},"
+    "memory: { verbose: false },"
+    "serial: { include_std: true },"
+    "includes: ['a.hpp', 'b.hpp', 'c.hpp'],"
+    "headers: ['#define X 1', '#define Y 2'],"
+  );
+
+  for (int i = 0; i < 16; ++i) {
+    props["defines/DEFINE_" + occa::toString(i)] = i;
+  }
+  return props;
+}
+
+template <class func_t>
+double timeLoop(func_t func, const int iterations) {
+  // Keep the result around so the loop isn't optimized out
+  int checksum = 0;
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    checksum += func();
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  if (checksum == -1) {
+    std::cout << ' ';
+  }
+  return 1e9 * elapsed / iterations;
+}
+
+static occa::properties baseProps;
+static occa::properties buildProps;
+
+int copyProperties() {
+  occa::properties props = baseProps;
+  return props.size();
+}
+
+int mergeProperties() {
+  occa::properties props = baseProps;
+  props += buildProps;
+  return props.size();
+}
+
+int mergeIntoEmpty() {
+  occa::properties props;
+  props += baseProps;
+  return props.size();
+}
+
+int lookupPaths() {
+  return (
+    baseProps.get<std::string>("kernel/compiler_flags").size()
+    + baseProps.get("okl/enabled", false)
+    + baseProps.has("defines/DEFINE_8")
+  );
+}
+
+int hashProperties() {
+  return baseProps.hash().h[0];
+}
+
+// Same as kernelBuilder::build(device, props)
+int hashMergedProperties() {
+  occa::properties props = buildProps;
+  props += baseProps;
+  return props.hash().h[0];
+}
+
+int main(const int argc, const char **argv) {
+  const int iterations = (argc > 1) ? atoi(argv[1]) : 100000;
+
+  baseProps = getKernelProperties();
+  buildProps = occa::properties(
+    "kernel: { compiler_flags: '-O2' },"
+    "defines: { BLOCK_SIZE: 256 },"
+    "okl: { validate: false },"
+  );
+
+  std::cout << "Copy:         " << timeLoop(copyProperties, iterations) << " ns\n"
+            << "Merge (+=):   " << timeLoop(mergeProperties, iterations) << " ns\n"
+            << "Merge empty:  " << timeLoop(mergeIntoEmpty, iterations) << " ns\n"
+            << "Path lookups: " << timeLoop(lookupPaths, iterations) << " ns\n"
+            << "hash():       " << timeLoop(hashProperties, iterations) << " ns\n"
+            << "Merge + hash: " << timeLoop(hashMergedProperties, iterations) << " ns\n";
+
+  return 0;
+}
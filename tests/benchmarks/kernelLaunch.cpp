@@ -0,0 +1,86 @@
+#include <cstdlib>
+#include <new>
+
+#include <occa.hpp>
+
+// Measures the host overhead of launching an empty kernel in Serial mode
+//   and the number of heap allocations per launch, for kernel calls and
+//   for launch plans from kernel::bind(...)
+//
+// Usage: benchmark-kernelLaunch [launches=1000000]
+
+static size_t allocations = 0;
+
+void* operator new(size_t bytes) {
+  ++allocations;
+  void *ptr = ::malloc(bytes ? bytes : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  ::free(ptr);
+}
+
+void operator delete(void *ptr, size_t bytes) noexcept {
+  ::free(ptr);
+}
+
+int main(int argc, char **argv) {
+  const int launches = (argc > 1) ? ::atoi(argv[1]) : 1000000;
+
+  occa::device device("mode: 'Serial'");
+
+  occa::kernel emptyKernel = device.buildKernelFromString(
+    "@kernel void emptyKernel(const int entries,\n"
+    "                         const float *a,\n"
+    "                         const float *b,\n"
+    "                         float *ab,\n"
+    "                         const float alpha) {\n"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {}\n"
+    "}\n",
+    "emptyKernel"
+  );
+
+  const int entries = 16;
+  occa::memory a  = device.malloc<float>(entries);
+  occa::memory b  = device.malloc<float>(entries);
+  occa::memory ab = device.malloc<float>(entries);
+
+  // Warm up
+  emptyKernel(entries, a, b, ab, 1.0f);
+
+  size_t startAllocations = allocations;
+  double startTime = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    emptyKernel(entries, a, b, ab, 1.0f);
+  }
+  double elapsed = occa::sys::currentTime() - startTime;
+  size_t launchAllocations = allocations - startAllocations;
+
+  std::cout << "kernel call\n"
+            << "  launches               : " << launches << '\n'
+            << "  time per launch        : " << (1e9 * elapsed / launches) << " ns\n"
+            << "  allocations per launch : " << ((double) launchAllocations / launches) << '\n';
+
+  occa::launchPlan plan = emptyKernel.bind(entries, a, b, ab, 1.0f);
+  plan();
+
+  startAllocations = allocations;
+  startTime = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    plan.setArg(4, (float) i);
+    plan();
+  }
+  elapsed = occa::sys::currentTime() - startTime;
+  launchAllocations = allocations - startAllocations;
+
+  std::cout << "launch plan\n"
+            << "  launches               : " << launches << '\n'
+            << "  time per launch        : " << (1e9 * elapsed / launches) << " ns\n"
+            << "  allocations per launch : " << ((double) launchAllocations / launches) << '\n';
+
+  return 0;
+}
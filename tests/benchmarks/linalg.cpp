@@ -0,0 +1,103 @@
+#include <cmath>
+#include <cstdlib>
+
+#include <occa.hpp>
+
+// Times occa::array reductions on the default device and checks them
+//   against host results, including the fused dot + l2Norm reduction
+//
+// Usage: benchmark-linalg [entries=1000000] [iterations=100]
+
+template <class func_t>
+double timeLoop(func_t func, const int iterations) {
+  // Keep the result around so the loop isn't optimized out
+  double checksum = 0;
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    checksum += func();
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  if (checksum < -1) {
+    std::cout << ' ';
+  }
+  return 1e6 * elapsed / iterations;
+}
+
+static occa::array<double> vec1, vec2;
+
+double runL1Norm() {
+  return vec1.l1Norm<double>();
+}
+
+double runL2Norm() {
+  return vec1.l2Norm<double>();
+}
+
+double runMax() {
+  return vec1.max();
+}
+
+double runDotThenNorm() {
+  return vec1.dot<double>(vec2) + vec1.l2Norm<double>();
+}
+
+double runDotAndL2Norm() {
+  double dotValue, normValue;
+  vec1.dotAndL2Norm<double>(vec2, dotValue, normValue);
+  return dotValue + normValue;
+}
+
+static bool check(const std::string &name,
+                  const double value,
+                  const double expected) {
+  const double error = std::abs(value - expected) / std::abs(expected);
+  if (error > 1e-10) {
+    std::cerr << name << ": got " << value
+              << ", expected " << expected << '\n';
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, const char **argv) {
+  const int entries = (argc > 1) ? atoi(argv[1]) : 1000000;
+  const int iterations = (argc > 2) ? atoi(argv[2]) : 100;
+
+  vec1.allocate(entries);
+  vec2.allocate(entries);
+
+  double norm1 = 0, norm2 = 0, dot = 0, maxValue = 0;
+  for (int i = 0; i < entries; ++i) {
+    const double v1 = 1 + (i % 97) * 0.5;
+    const double v2 = 2 - (i % 13) * 0.25;
+    vec1[i] = v1;
+    vec2[i] = v2;
+    norm1    += v1;
+    norm2    += v1 * v1;
+    dot      += v1 * v2;
+    maxValue = (maxValue < v1) ? v1 : maxValue;
+  }
+
+  double dotValue, normValue;
+  vec1.dotAndL2Norm<double>(vec2, dotValue, normValue);
+
+  const bool passed = (
+    check("l1Norm", vec1.l1Norm<double>(), norm1)
+    && check("l2Norm", vec1.l2Norm<double>(), std::sqrt(norm2))
+    && check("max", vec1.max(), maxValue)
+    && check("dot", vec1.dot<double>(vec2), dot)
+    && check("dotAndL2Norm (dot)", dotValue, dot)
+    && check("dotAndL2Norm (norm)", normValue, std::sqrt(norm2))
+  );
+  if (!passed) {
+    return 1;
+  }
+
+  std::cout << "l1Norm:             " << timeLoop(runL1Norm, iterations) << " us\n"
+            << "l2Norm:             " << timeLoop(runL2Norm, iterations) << " us\n"
+            << "max:                " << timeLoop(runMax, iterations) << " us\n"
+            << "dot + l2Norm:       " << timeLoop(runDotThenNorm, iterations) << " us\n"
+            << "dotAndL2Norm:       " << timeLoop(runDotAndL2Norm, iterations) << " us\n";
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include <cstdlib>
+
+#include <occa.hpp>
+
+// Times allocating and freeing solver-like temporaries each iteration
+//   with and without the device memory pool
+//
+// Usage: benchmark-memoryPool [iterations=10000]
+
+static const int temporaryCount = 6;
+static const occa::udim_t temporaryBytes[temporaryCount] = {
+  64, 4096, 100000, 1 << 20, 3 << 20, 16 << 20
+};
+
+double timeIterations(occa::device device, const int iterations) {
+  occa::memory temporaries[temporaryCount];
+
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    for (int t = 0; t < temporaryCount; ++t) {
+      temporaries[t] = device.malloc(temporaryBytes[t]);
+    }
+    for (int t = 0; t < temporaryCount; ++t) {
+      temporaries[t].free();
+    }
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  return 1e9 * elapsed / (iterations * temporaryCount);
+}
+
+int main(int argc, char **argv) {
+  const int iterations = (argc > 1) ? ::atoi(argv[1]) : 10000;
+
+  occa::device device("mode: 'Serial'");
+  occa::device poolDevice(
+    "mode: 'Serial',"
+    "memory_pool: { enabled: true }"
+  );
+
+  std::cout << "malloc + free:        " << timeIterations(device, iterations) << " ns\n"
+            << "malloc + free (pool): " << timeIterations(poolDevice, iterations) << " ns\n"
+            << "  hits: " << poolDevice.memoryPoolHits()
+            << ", misses: " << poolDevice.memoryPoolMisses()
+            << ", cached: " << poolDevice.memoryPoolBytes() << " bytes"
+            << ", max allocated: " << poolDevice.maxMemoryAllocated() << " bytes\n";
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include <cstdlib>
+
+#include <occa.hpp>
+
+// Times slicing memory and turning the slice into a kernel argument,
+//   comparing allocation-free views against materialized memory objects
+//
+// Usage: benchmark-memoryView [iterations=1000000]
+
+double timeViews(occa::memory mem, const int iterations) {
+  const int length = (int) mem.length();
+
+  // Keep the results around so the loop isn't optimized out
+  size_t checksum = 0;
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    occa::kernelArg arg = mem.slice(i % length, 1);
+    checksum += (size_t) arg[0].ptr();
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  if (checksum == 1) {
+    std::cout << ' ';
+  }
+  return 1e9 * elapsed / iterations;
+}
+
+double timeMemorySlices(occa::memory mem, const int iterations) {
+  const int length = (int) mem.length();
+
+  size_t checksum = 0;
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    occa::memory slice = mem.slice(i % length, 1);
+    occa::kernelArg arg = slice;
+    checksum += (size_t) arg[0].ptr();
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+  if (checksum == 1) {
+    std::cout << ' ';
+  }
+  return 1e9 * elapsed / iterations;
+}
+
+int main(int argc, char **argv) {
+  const int iterations = (argc > 1) ? ::atoi(argv[1]) : 1000000;
+
+  occa::device device("mode: 'Serial'");
+  occa::memory mem = device.malloc<float>(1024);
+
+  std::cout << "slice -> memoryView: " << timeViews(mem, iterations) << " ns\n"
+            << "slice -> memory:     " << timeMemorySlices(mem, iterations) << " ns\n";
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <occa.hpp>
+
+// Stress test for UVA lookups: threads repeatedly occa::memcpy between
+//   their own managed pointers while sharing the UVA index
+//
+// Usage: benchmark-uva [copies=200000] [maxThreads=8] [buffers=256]
+
+static const int copyBytes = 64;
+
+static std::vector<char*> buffers;
+
+void copyLoop(const int thread,
+              const int threads,
+              const int copies,
+              const occa::properties &props) {
+  const int bufferCount = (int) buffers.size();
+  for (int i = 0; i < copies; ++i) {
+    // Threads touch disjoint buffers
+    const int index = (thread + (i * threads)) % bufferCount;
+    char *src  = buffers[index];
+    char *dest = buffers[(index + threads) % bufferCount];
+    occa::memcpy(dest + (i % copyBytes), src, copyBytes, props);
+  }
+}
+
+double timeThreads(const int threads, const int copies) {
+  const occa::properties props;
+  std::vector<std::thread> workers;
+
+  const double start = occa::sys::currentTime();
+  for (int t = 0; t < threads; ++t) {
+    workers.push_back(std::thread(copyLoop, t, threads, copies, std::ref(props)));
+  }
+  for (int t = 0; t < threads; ++t) {
+    workers[t].join();
+  }
+  const double elapsed = occa::sys::currentTime() - start;
+
+  // Aggregate copies per microsecond
+  return (threads * (double) copies) / (1e6 * elapsed);
+}
+
+int main(int argc, char **argv) {
+  const int copies = (argc > 1) ? ::atoi(argv[1]) : 200000;
+  const int maxThreads = (argc > 2) ? ::atoi(argv[2]) : 8;
+  const int bufferCount = (argc > 3) ? ::atoi(argv[3]) : 256;
+
+  occa::device device("mode: 'Serial'");
+  for (int i = 0; i < bufferCount; ++i) {
+    buffers.push_back(
+      (char*) device.umalloc(2 * copyBytes, occa::dtype::byte)
+    );
+  }
+
+  for (int threads = 1; threads <= maxThreads; threads *= 2) {
+    std::cout << threads << " thread(s): "
+              << timeThreads(threads, copies) << " memcpy/us\n";
+  }
+
+  for (int i = 0; i < bufferCount; ++i) {
+    occa::freeUvaPtr(buffers[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testPartials();
+void testReductions();
+void testReductions(const int entries);
+
+int main(const int argc, const char **argv) {
+  testPartials();
+  testReductions();
+
+  return 0;
+}
+
+void testPartials() {
+  const int partials = occa::linalg::reductionPartials;
+  const int segments = 2;
+
+  std::vector<double> values(segments * partials);
+  for (int i = 0; i < partials; ++i) {
+    values[i] = i + 1;
+    values[partials + i] = -((7 * i) % 101) - 5;
+  }
+
+  double sums[segments] = {0, 0};
+  double maxs[segments], mins[segments];
+  for (int s = 0; s < segments; ++s) {
+    maxs[s] = mins[s] = values[s * partials];
+    for (int i = 0; i < partials; ++i) {
+      const double value = values[s * partials + i];
+      sums[s] += value;
+      maxs[s] = std::max(maxs[s], value);
+      mins[s] = std::min(mins[s], value);
+    }
+  }
+
+  occa::memory mem = occa::malloc(values.size() * sizeof(double),
+                                  &(values[0]));
+
+  double *result = occa::linalg::sumPartials<double>(mem, segments);
+  for (int s = 0; s < segments; ++s) {
+    ASSERT_EQ(result[s], sums[s]);
+  }
+
+  result = occa::linalg::maxPartials<double>(mem, segments);
+  for (int s = 0; s < segments; ++s) {
+    ASSERT_EQ(result[s], maxs[s]);
+  }
+
+  result = occa::linalg::minPartials<double>(mem, segments);
+  for (int s = 0; s < segments; ++s) {
+    ASSERT_EQ(result[s], mins[s]);
+  }
+
+  // Default is a single segment
+  ASSERT_EQ(*occa::linalg::sumPartials<double>(mem), sums[0]);
+}
+
+void testReductions() {
+  // Include sizes that aren't multiples of the tile size or partials
+  testReductions(1);
+  testReductions(1000);
+  testReductions(1023);
+  testReductions(1025);
+  testReductions(100003);
+}
+
+void testReductions(const int entries) {
+  // Integer values keep the host and device sums exact
+  std::vector<double> a(entries), b(entries);
+  for (int i = 0; i < entries; ++i) {
+    a[i] = (i % 17) - 8;
+    b[i] = (i % 5) + 1;
+  }
+  a[entries / 2] = 20;
+
+  double sum = 0, norm1 = 0, norm2 = 0, dot = 0;
+  double maxValue = a[0], minValue = a[0];
+  for (int i = 0; i < entries; ++i) {
+    sum   += a[i];
+    norm1 += std::abs(a[i]);
+    norm2 += a[i] * a[i];
+    dot   += a[i] * b[i];
+    maxValue = std::max(maxValue, a[i]);
+    minValue = std::min(minValue, a[i]);
+  }
+  norm2 = std::sqrt(norm2);
+
+  occa::memory vec1 = occa::malloc(entries * sizeof(double), &(a[0]));
+  occa::memory vec2 = occa::malloc(entries * sizeof(double), &(b[0]));
+
+  ASSERT_EQ((occa::linalg::sum<double, double>(vec1)), sum);
+  ASSERT_EQ((occa::linalg::max<double, double>(vec1)), maxValue);
+  ASSERT_EQ((occa::linalg::min<double, double>(vec1)), minValue);
+  ASSERT_EQ((occa::linalg::l1Norm<double, double>(vec1)), norm1);
+  ASSERT_EQ((occa::linalg::l2Norm<double, double>(vec1)), norm2);
+  ASSERT_EQ((occa::linalg::dot<double, double, double>(vec1, vec2)), dot);
+
+  double dotValue = 0, normValue = 0;
+  occa::linalg::dotAndL2Norm<double, double, double>(vec1, vec2,
+                                                     dotValue, normValue);
+  ASSERT_EQ(dotValue, dot);
+  ASSERT_EQ(normValue, norm2);
+}
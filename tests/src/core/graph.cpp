@@ -0,0 +1,282 @@
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+const std::string graphKernelsSource = (
+  "@kernel void addOne(const int entries, int *values) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    values[i] += 1;\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "@kernel void addVectors(const int entries,\n"
+  "                        const int *a,\n"
+  "                        const int *b,\n"
+  "                        int *ab) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    ab[i] = a[i] + b[i];\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "@kernel void addPair(const int entries, const int2 pair, int *values) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    values[i] += pair.x + pair.y;\n"
+  "  }\n"
+  "}\n"
+);
+
+void testCapture();
+void testStreamDependencies();
+void testCaptureErrors();
+void testFreedResources();
+void testCapturedValues();
+
+int main(const int argc, const char **argv) {
+  testCapture();
+  testStreamDependencies();
+  testCaptureErrors();
+  testFreedResources();
+  testCapturedValues();
+
+  return 0;
+}
+
+void testCapture() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addOne = device.buildKernelFromString(graphKernelsSource,
+                                                     "addOne");
+  occa::kernel addVectors = device.buildKernelFromString(graphKernelsSource,
+                                                         "addVectors");
+
+  const int entries = 10;
+  int a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+    b[i] = 2 * i;
+    ab[i] = 0;
+  }
+
+  occa::memory o_a = device.malloc<int>(entries);
+  occa::memory o_b = device.malloc<int>(entries, b);
+  occa::memory o_ab = device.malloc<int>(entries, ab);
+
+  ASSERT_FALSE(device.isCapturing());
+  device.beginCapture();
+  ASSERT_TRUE(device.isCapturing());
+
+  o_a.copyFrom(a);
+  addOne(entries, o_a);
+  addVectors.bind(entries, o_a, o_b, o_ab)();
+  o_ab.copyTo(ab);
+
+  occa::graph graph = device.endCapture();
+  ASSERT_FALSE(device.isCapturing());
+  ASSERT_TRUE(graph.isInitialized());
+  ASSERT_EQ(graph.size(), 4);
+  ASSERT_EQ(graph.mode(), "Serial");
+
+  // Nothing runs while capturing
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 0);
+  }
+
+  graph.run();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], (i + 1) + (2 * i));
+  }
+
+  // Replays read the captured host pointers again
+  for (int i = 0; i < entries; ++i) {
+    a[i] = 10;
+  }
+  graph();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 11 + (2 * i));
+  }
+
+  graph.free();
+  ASSERT_FALSE(graph.isInitialized());
+  ASSERT_EQ(graph.size(), 0);
+}
+
+void testStreamDependencies() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addOne = device.buildKernelFromString(graphKernelsSource,
+                                                     "addOne");
+  occa::kernel addVectors = device.buildKernelFromString(graphKernelsSource,
+                                                         "addVectors");
+
+  const int entries = 100;
+  int zeros[entries];
+  for (int i = 0; i < entries; ++i) {
+    zeros[i] = 0;
+  }
+  occa::memory o_x = device.malloc<int>(entries, zeros);
+  occa::memory o_y = device.malloc<int>(entries, zeros);
+  occa::memory o_xy = device.malloc<int>(entries, zeros);
+
+  occa::stream defaultStream = device.getStream();
+  occa::stream stream1 = device.createStream();
+  occa::stream stream2 = device.createStream();
+
+  device.beginCapture("threads: 2");
+
+  device.setStream(stream1);
+  addOne(entries, o_x);
+  occa::streamTag xTag = device.tagStream();
+
+  device.setStream(stream2);
+  addOne(entries, o_y);
+  addOne(entries, o_y);
+  device.waitFor(xTag);
+  addVectors(entries, o_x, o_y, o_xy);
+
+  occa::graph graph = device.endCapture();
+  device.setStream(defaultStream);
+
+  const std::vector<occa::graphNode> &nodes = graph.getModeGraph()->nodes;
+  ASSERT_EQ((int) nodes.size(), 4);
+  ASSERT_EQ((int) nodes[0].dependencies.size(), 0);
+  ASSERT_EQ((int) nodes[1].dependencies.size(), 0);
+  ASSERT_EQ((int) nodes[2].dependencies.size(), 1);
+  ASSERT_EQ((int) nodes[3].dependencies.size(), 2);
+  ASSERT_TRUE(nodes[0].modeStream == stream1.getModeStream());
+  ASSERT_TRUE(nodes[3].modeStream == stream2.getModeStream());
+
+  int *xy = (int*) o_xy.ptr();
+  for (int run = 1; run <= 10; ++run) {
+    graph.run();
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(xy[i], 3 * run);
+    }
+  }
+
+  // Generic replay through stream tags
+  graph.getModeGraph()->occa::modeGraph_t::run();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(xy[i], 33);
+  }
+  ASSERT_TRUE(device.getStream() == defaultStream);
+}
+
+void testCaptureErrors() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addOne = device.buildKernelFromString(graphKernelsSource,
+                                                     "addOne");
+
+  ASSERT_THROW(
+    device.endCapture();
+  );
+
+  device.beginCapture();
+  ASSERT_THROW(
+    device.beginCapture();
+  );
+  occa::graph emptyGraph = device.endCapture();
+  ASSERT_EQ(emptyGraph.size(), 0);
+  emptyGraph.run();
+
+  // Arguments are validated when captured
+  occa::memory o_float = device.malloc<float>(10);
+  device.beginCapture();
+  ASSERT_THROW(
+    addOne(10, o_float);
+  );
+  ASSERT_THROW(
+    emptyGraph.run();
+  );
+  occa::graph graph = device.endCapture();
+  ASSERT_EQ(graph.size(), 0);
+
+  occa::graph uninitializedGraph;
+  ASSERT_THROW(
+    uninitializedGraph.run();
+  );
+}
+
+void testFreedResources() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addOne = device.buildKernelFromString(graphKernelsSource,
+                                                     "addOne");
+
+  const int entries = 10;
+  int values[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = i;
+  }
+
+  // Captured resources stay alive after their handles are dropped
+  occa::graph graph;
+  {
+    occa::memory o_values = device.malloc<int>(entries, values);
+    occa::memory o_copy = device.malloc<int>(entries);
+
+    device.beginCapture();
+    addOne(entries, o_values);
+    o_copy.copyFrom(o_values);
+    o_copy.copyTo(values);
+    graph = device.endCapture();
+  }
+  addOne = occa::kernel();
+
+  graph.run();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(values[i], i + 1);
+  }
+
+  // Freeing a captured buffer invalidates the graph
+  occa::memory o_values = device.malloc<int>(entries, values);
+  occa::memory o_copy = device.malloc<int>(entries);
+  device.beginCapture();
+  o_copy.copyFrom(o_values);
+  occa::graph copyGraph = device.endCapture();
+  copyGraph.run();
+
+  o_values.free();
+  ASSERT_THROW(
+    copyGraph.run();
+  );
+
+  // Freeing a captured kernel invalidates the graph
+  occa::kernel addOneAgain = device.buildKernelFromString(graphKernelsSource,
+                                                          "addOne");
+  device.beginCapture();
+  addOneAgain(entries, o_copy);
+  occa::graph kernelGraph = device.endCapture();
+  kernelGraph.run();
+
+  addOneAgain.free();
+  ASSERT_THROW(
+    kernelGraph.run();
+  );
+}
+
+void testCapturedValues() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addPair = device.buildKernelFromString(graphKernelsSource,
+                                                      "addPair");
+
+  const int entries = 10;
+  int values[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = i;
+  }
+  occa::memory o_values = device.malloc<int>(entries, values);
+
+  // The int2 temporaries are gone by the time the graph runs
+  device.beginCapture();
+  for (int i = 0; i < 3; ++i) {
+    addPair(entries, occa::int2(i, 1), o_values);
+  }
+  o_values.copyTo(values);
+  occa::graph graph = device.endCapture();
+
+  graph.run();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(values[i], i + 6);
+  }
+
+  graph.run();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(values[i], i + 12);
+  }
+}
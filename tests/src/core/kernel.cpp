@@ -1,4 +1,5 @@
 #include <occa.hpp>
+#include <occa/modes/serial/jit.hpp>
 #include <occa/tools/testing.hpp>
 
 occa::kernel addVectors;
@@ -11,7 +12,16 @@ void testInfo();
 void testParsingFailure();
 void testCompilingFailure();
 void testArgumentFailure();
+void testKernelArgs();
+void testTypeValidationCache();
+void testLaunchPlan();
+void testLaunchPlanValues();
 void testRun();
+void testBuildKernels();
+void testBuildKernelAsync();
+void testJit();
+void testKernelCache();
+void testThreadPoolKernel();
 
 int main(const int argc, const char **argv) {
   addVectors = occa::buildKernel(addVectorsFile,
@@ -22,7 +32,16 @@ int main(const int argc, const char **argv) {
   testParsingFailure();
   testCompilingFailure();
   testArgumentFailure();
+  testKernelArgs();
+  testTypeValidationCache();
+  testLaunchPlan();
+  testLaunchPlanValues();
   testRun();
+  testBuildKernels();
+  testBuildKernelAsync();
+  testJit();
+  testKernelCache();
+  testThreadPoolKernel();
 
   return 0;
 }
@@ -140,6 +159,183 @@ void testArgumentFailure() {
   );
 }
 
+void testKernelArgs() {
+  occa::kernelArg arg((int) 1);
+  ASSERT_EQ(arg.size(), 1);
+
+  // Spill past the inline arguments
+  arg.add(occa::kernelArg((int) 2));
+  arg.add(occa::kernelArg((int) 3));
+  arg.add(occa::kernelArg((int) 4));
+  ASSERT_EQ(arg.size(), 4);
+
+  occa::kernelArg argCopy = arg;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(argCopy[i].data.int32_, i + 1);
+  }
+}
+
+void testTypeValidationCache() {
+  const int entries = 10;
+  occa::memory a = occa::malloc<float>(entries);
+  occa::memory b = occa::malloc<float>(entries);
+  occa::memory ab = occa::malloc<float>(entries);
+  occa::memory intAb = occa::malloc<int>(entries);
+
+  addVectors(entries, a, b, ab);
+  addVectors(entries, a, b, ab);
+
+  // Changing an argument's type is validated again
+  ASSERT_THROW(
+    addVectors(entries, a, b, intAb);
+  );
+  ASSERT_THROW(
+    addVectors(entries, a, b);
+  );
+
+  addVectors(entries, a, b, ab);
+
+  // Views are validated with their own dtype, not their memory's
+  occa::memory intMem = occa::malloc<int>(2 * entries);
+  addVectors(entries, a, b, intMem.slice(entries).as(occa::dtype::float_));
+  ASSERT_THROW(
+    addVectors(entries, a, b, intMem.slice(entries));
+  );
+  addVectors(entries, a, b, intMem.slice(entries).as(occa::dtype::float_));
+}
+
+void testLaunchPlan() {
+  occa::kernel scale = occa::buildKernelFromString(
+    "@kernel void scale(const int N, const float alpha, float *x) {"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+    "    x[i] *= alpha;"
+    "  }"
+    "}",
+    "scale"
+  );
+
+  // Host kernels are launched through a trampoline
+  const std::string source = occa::io::read(
+    occa::io::dirname(scale.binaryFilename()) + occa::kc::sourceFile
+  );
+  ASSERT_NEQ(source.find("_occa_trampoline_scale"), std::string::npos);
+
+  const int entries = 10;
+  float values[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = 1;
+  }
+  occa::memory x = occa::malloc<float>(entries, values);
+  occa::memory intX = occa::malloc<int>(entries);
+
+  occa::launchPlan plan = scale.bind(entries, 2.0f, x);
+  ASSERT_TRUE(plan.isInitialized());
+  ASSERT_EQ(plan.argumentCount(), 3);
+  ASSERT_TRUE(plan.getKernel() == scale);
+
+  plan();
+  plan.setArg(1, 3.0f);
+  plan.run();
+
+  x.copyTo(values);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ((int) values[i], 6);
+  }
+
+  // Launches in between don't change the bound arguments
+  scale(entries, 0.5f, x);
+  plan.setArg(0, entries / 2);
+  plan();
+
+  x.copyTo(values);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ((int) values[i], (i < (entries / 2)) ? 9 : 3);
+  }
+
+  // Changing argument types is validated
+  ASSERT_THROW(
+    plan.setArg(2, intX);
+  );
+  ASSERT_THROW(
+    plan.setArg(3, 1.0f);
+  );
+  ASSERT_THROW(
+    scale.bind(entries, 2.0f);
+  );
+
+  // Trampolines for kernels named like std:: functions still compile
+  occa::kernel distance = occa::buildKernelFromString(
+    "@kernel void distance(const int N, float *x) {"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+    "    x[i] = 1;"
+    "  }"
+    "}",
+    "distance"
+  );
+  distance.bind(entries, x)();
+
+  x.copyTo(values);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ((int) values[i], 1);
+  }
+
+  occa::launchPlan emptyPlan;
+  ASSERT_FALSE(emptyPlan.isInitialized());
+  ASSERT_THROW(
+    emptyPlan();
+  );
+
+  scale.free();
+  ASSERT_FALSE(plan.isInitialized());
+  ASSERT_THROW(
+    plan();
+  );
+}
+
+void testLaunchPlanValues() {
+  occa::kernel addPair = occa::buildKernelFromString(
+    "@kernel void addPair(const int N, const float2 pair, float *x) {"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+    "    x[i] += pair.x + pair.y;"
+    "  }"
+    "}",
+    "addPair"
+  );
+
+  const int entries = 10;
+  float values[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = 0;
+  }
+  occa::memory x = occa::malloc<float>(entries, values);
+
+  // Plans keep the float2 values after the temporaries are gone
+  std::vector<occa::launchPlan> plans;
+  for (int i = 0; i < 3; ++i) {
+    plans.push_back(addPair.bind(entries, occa::float2(i, 1), x));
+  }
+  for (int i = 0; i < 3; ++i) {
+    plans[i]();
+  }
+
+  x.copyTo(values);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ((int) values[i], 6);
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    plans[i].setArg(1, occa::float2(i, 2));
+  }
+  for (int i = 0; i < 3; ++i) {
+    plans[i]();
+  }
+
+  x.copyTo(values);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ((int) values[i], 15);
+  }
+}
+
 void testRun() {
   std::string argKernelFile = (
     occa::env::OCCA_DIR + "tests/files/argKernel.okl"
@@ -180,3 +376,315 @@ void testRun() {
 
   occa::freeUvaPtr(uvaPtr);
 }
+
+void testBuildKernels() {
+  occa::device device("mode: 'Serial', compile_jobs: 2");
+
+  // Force new binaries to be compiled
+  occa::properties props;
+  props["defines/OCCA_TEST_BUILD_SEED"] = (int) occa::sys::currentTime();
+
+  occa::kernelBuildRequestVector requests;
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors", props)
+  );
+  // Shares the binary with the first request
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors", props)
+  );
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors")
+  );
+
+  occa::kernelFutureVector futures = device.buildKernels(requests);
+  ASSERT_EQ(3, (int) futures.size());
+
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(futures[i].isInitialized());
+  }
+
+  for (int i = 2; i >= 0; --i) {
+    occa::kernel kernel = futures[i].get();
+    ASSERT_TRUE(kernel.isInitialized());
+    ASSERT_TRUE(futures[i].isReady());
+    ASSERT_EQ(kernel.name(),
+              "addVectors");
+    ASSERT_EQ(kernel.getDevice(),
+              device);
+    // Futures resolve once
+    ASSERT_TRUE(kernel == futures[i].get());
+  }
+
+  ASSERT_EQ(futures[0].get().binaryFilename(),
+            futures[1].get().binaryFilename());
+  ASSERT_NEQ(futures[0].get().binaryFilename(),
+             futures[2].get().binaryFilename());
+
+  occa::kernelFuture emptyFuture;
+  ASSERT_FALSE(emptyFuture.isInitialized());
+  ASSERT_FALSE(emptyFuture.get().isInitialized());
+}
+
+void runAddVectors(occa::device device,
+                   occa::kernel kernel) {
+  const int entries = 8;
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i]  = i;
+    b[i]  = 1 - i;
+    ab[i] = 0;
+  }
+
+  occa::memory o_a  = device.malloc<float>(entries, a);
+  occa::memory o_b  = device.malloc<float>(entries, b);
+  occa::memory o_ab = device.malloc<float>(entries);
+
+  kernel(entries, o_a, o_b, o_ab);
+
+  o_ab.copyTo(ab);
+  // addVectors also accumulates into the first 3 entries
+  for (int i = 3; i < entries; ++i) {
+    ASSERT_EQ(1, (int) ab[i]);
+  }
+}
+
+void testBuildKernelAsync() {
+  occa::device device("mode: 'Serial', compile_jobs: 1");
+
+  // Force new binaries to be compiled
+  occa::properties props;
+  props["defines/OCCA_TEST_ASYNC_SEED"] = (int) occa::sys::currentTime();
+
+  // Without a fallback, the first launch waits for the build
+  occa::kernel kernel = device.buildKernelAsync(addVectorsFile,
+                                                "addVectors",
+                                                props);
+  ASSERT_TRUE(kernel.isInitialized());
+  ASSERT_EQ(kernel.name(),
+            "addVectors");
+
+  runAddVectors(device, kernel);
+
+  occa::asyncModeKernel_t *asyncKernel = (
+    (occa::asyncModeKernel_t*) kernel.getModeKernel()
+  );
+  ASSERT_TRUE(asyncKernel->isOptimized());
+  ASSERT_TRUE(kernel.hash().isInitialized());
+  ASSERT_TRUE(
+    occa::startsWith(kernel.binaryFilename(),
+                     occa::io::cachePath())
+  );
+
+  // Launches use the fallback until the optimized build is loaded
+  props["defines/OCCA_TEST_ASYNC_SEED"] = (int) occa::sys::currentTime() + 1;
+  props["fallback"] = occa::properties();
+
+  kernel = device.buildKernelAsync(addVectorsFile,
+                                   "addVectors",
+                                   props);
+  asyncKernel = (occa::asyncModeKernel_t*) kernel.getModeKernel();
+
+  runAddVectors(device, kernel);
+  runAddVectors(device, kernel);
+
+  asyncKernel->getOptimizedKernel();
+  ASSERT_TRUE(asyncKernel->isOptimized());
+  runAddVectors(device, kernel);
+
+  // The source is only read in the compile pool
+  kernel = device.buildKernelAsync("missingAsyncKernel.okl",
+                                   "addVectors");
+  ASSERT_TRUE(kernel.isInitialized());
+  ASSERT_THROW(
+    runAddVectors(device, kernel);
+  );
+
+  kernel.free();
+  device.free();
+}
+
+void testJit() {
+  occa::device device("mode: 'Serial'");
+
+  occa::properties props;
+  props["defines/OCCA_TEST_JIT_SEED"] = (int) occa::sys::currentTime();
+  props["jit/enabled"] = true;
+
+  occa::kernel kernel = device.buildKernel(addVectorsFile,
+                                           "addVectors",
+                                           props);
+  ASSERT_TRUE(kernel.isInitialized());
+  runAddVectors(device, kernel);
+
+  // Without libclang the compiler is used instead
+  ASSERT_EQ(occa::serial::jit::isAvailable(),
+            occa::endsWith(kernel.binaryFilename(),
+                           occa::kc::jitBinaryFile));
+
+  // Loads the cached binary
+  occa::kernel cachedKernel = device.buildKernel(addVectorsFile,
+                                                 "addVectors",
+                                                 props);
+  ASSERT_EQ(kernel.binaryFilename(),
+            cachedKernel.binaryFilename());
+  runAddVectors(device, cachedKernel);
+}
+
+void testKernelCache() {
+  occa::device device("mode: 'Serial'");
+  occa::modeDevice_t *modeDevice = device.getModeDevice();
+
+  occa::properties props;
+  props["defines/OCCA_TEST_CACHE_SEED"] = (int) occa::sys::currentTime();
+
+  occa::kernel kernel = device.buildKernel(addVectorsFile,
+                                           "addVectors",
+                                           props);
+  ASSERT_EQ(0, (int) device.kernelCacheHits());
+  ASSERT_EQ(1, (int) device.kernelCacheMisses());
+
+  // Cache hits share the binary but not the launch state
+  occa::kernel cachedKernel = device.buildKernel(addVectorsFile,
+                                                 "addVectors",
+                                                 props);
+  ASSERT_TRUE(kernel != cachedKernel);
+  ASSERT_EQ(kernel.binaryFilename(),
+            cachedKernel.binaryFilename());
+  ASSERT_EQ(1, (int) device.kernelCacheHits());
+
+  kernel.setRunDims(occa::dim(2), occa::dim(3));
+  cachedKernel.setRunDims(occa::dim(4), occa::dim(5));
+  ASSERT_EQ(2, (int) kernel.getModeKernel()->outerDims.x);
+  ASSERT_EQ(4, (int) cachedKernel.getModeKernel()->outerDims.x);
+
+  // Freeing a cache hit doesn't free the other builds
+  cachedKernel.free();
+  ASSERT_FALSE(cachedKernel.isInitialized());
+  ASSERT_TRUE(kernel.isInitialized());
+  runAddVectors(device, kernel);
+
+  cachedKernel = device.buildKernel(addVectorsFile,
+                                    "addVectors",
+                                    props);
+  ASSERT_EQ(2, (int) device.kernelCacheHits());
+  runAddVectors(device, cachedKernel);
+
+  occa::properties otherProps = props;
+  otherProps["defines/OCCA_TEST_CACHE_OTHER"] = 1;
+  occa::kernel otherKernel = device.buildKernel(addVectorsFile,
+                                                "addVectors",
+                                                otherProps);
+  ASSERT_TRUE(kernel != otherKernel);
+  ASSERT_EQ(2, (int) device.kernelCacheMisses());
+  ASSERT_EQ(2, (int) modeDevice->cachedKernels.size());
+
+  // Builds stay cached while any kernel sharing them is alive
+  kernel.free();
+  ASSERT_EQ(2, (int) modeDevice->cachedKernels.size());
+  ASSERT_TRUE(cachedKernel.isInitialized());
+  runAddVectors(device, cachedKernel);
+
+  kernel = device.buildKernel(addVectorsFile,
+                              "addVectors",
+                              props);
+  ASSERT_EQ(3, (int) device.kernelCacheHits());
+  runAddVectors(device, kernel);
+
+  // The cache doesn't keep kernels alive
+  kernel = occa::kernel();
+  cachedKernel = occa::kernel();
+  ASSERT_EQ(1, (int) modeDevice->cachedKernels.size());
+
+  kernel = device.buildKernel(addVectorsFile,
+                              "addVectors",
+                              props);
+  ASSERT_EQ(3, (int) device.kernelCacheMisses());
+  runAddVectors(device, kernel);
+
+  // Freed kernels are removed from the cache
+  otherKernel.free();
+  ASSERT_EQ(1, (int) modeDevice->cachedKernels.size());
+
+  // Futures of cached kernels are ready
+  occa::kernelFuture future = device.startKernelBuild(addVectorsFile,
+                                                      "addVectors",
+                                                      props);
+  ASSERT_TRUE(future.isReady());
+  ASSERT_TRUE(future.get().isInitialized());
+  ASSERT_TRUE(kernel != future.get());
+  ASSERT_EQ(4, (int) device.kernelCacheHits());
+
+  // String sources are cached by content
+  const std::string source = occa::io::read(addVectorsFile);
+  occa::kernel stringKernel = device.buildKernelFromString(source,
+                                                           "addVectors",
+                                                           props);
+  ASSERT_EQ(kernel.binaryFilename(),
+            stringKernel.binaryFilename());
+  runAddVectors(device, stringKernel);
+  ASSERT_EQ(5, (int) device.kernelCacheHits());
+  ASSERT_EQ(3, (int) device.kernelCacheMisses());
+
+  // Hits don't read the source again
+  const std::string copiedFile = occa::env::CWD + "cached_addVectors.okl";
+  occa::io::write(copiedFile, source);
+  occa::kernel copiedKernel = device.buildKernel(copiedFile,
+                                                 "addVectors",
+                                                 props);
+  ASSERT_EQ(6, (int) device.kernelCacheHits());
+
+  occa::sys::rmrf(copiedFile);
+  occa::kernel copiedKernel2 = device.buildKernel(copiedFile,
+                                                  "addVectors",
+                                                  props);
+  ASSERT_EQ(7, (int) device.kernelCacheHits());
+  ASSERT_EQ(3, (int) device.kernelCacheMisses());
+  runAddVectors(device, copiedKernel2);
+}
+
+void testThreadPoolKernel() {
+  if (!occa::modeIsEnabled("OpenMP")) {
+    return;
+  }
+
+  occa::device device("mode: 'OpenMP'");
+
+  const std::string fillSource = (
+    "@kernel void fill(const int N, int *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 4; k >= 0; k -= 2; @outer) {\n"
+    "      for (int j = 0; j < 4; ++j; @inner) {\n"
+    "        const int index = 12*i + 4*(k / 2) + j;\n"
+    "        a[index] += index + 1;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+
+  occa::properties props;
+  props["parallel_for"] = "thread_pool";
+  props["thread_pool/collapse"] = 2;
+  props["thread_pool/chunk_size"] = 5;
+  props["serial/include_std"] = false;
+
+  occa::kernel fill = device.buildKernelFromString(fillSource,
+                                                   "fill",
+                                                   props);
+
+  const int N = 7;
+  const int entries = 12 * N;
+  int a[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = 0;
+  }
+  occa::memory o_a = device.malloc<int>(entries, a);
+
+  fill(N, o_a);
+
+  // Every iteration of the merged @outer loops ran once
+  o_a.copyTo(a);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(i + 1, a[i]);
+  }
+}
@@ -4,11 +4,13 @@
 void testMalloc();
 void testCpuWrapMemory();
 void testSlice();
+void testView();
 
 int main(const int argc, const char **argv) {
   testMalloc();
   testCpuWrapMemory();
   testSlice();
+  testView();
 
   return 0;
 }
@@ -116,3 +118,73 @@ void testSlice() {
   }
   ASSERT_SAME_SIZE(device.memoryAllocated(), 0);
 }
+
+void testView() {
+  float *data = new float[10];
+  for (int i = 0; i < 10; ++i) {
+    data[i] = i;
+  }
+
+  occa::device device("mode: 'Serial'");
+  occa::memory mem = device.malloc<float>(10, data);
+  occa::modeMemory_t *modeMemory = mem.getModeMemory();
+
+  // Views share the parent memory
+  occa::memoryView view = mem.slice(2, 6);
+  ASSERT_EQ(view.getModeMemory(), modeMemory);
+  ASSERT_EQ(view.offset(), (occa::udim_t) (2 * sizeof(float)));
+  ASSERT_EQ(view.size(), (occa::udim_t) (6 * sizeof(float)));
+  ASSERT_EQ(view.length(), (occa::udim_t) 6);
+  ASSERT_EQ(view.dtype(), occa::dtype::float_);
+  ASSERT_EQ(view.ptr<float>(), mem.ptr<float>() + 2);
+
+  view += 1;
+  ASSERT_EQ(view.ptr<float>()[0], (float) 3);
+  ASSERT_EQ(view.length(), (occa::udim_t) 5);
+  ASSERT_TRUE(view == mem.slice(3, 5));
+  ASSERT_TRUE(view != (mem + 3));
+
+  occa::memoryView view2 = (view + 1).slice(1, 2);
+  ASSERT_EQ(view2.ptr<float>()[0], (float) 5);
+  ASSERT_EQ(view2.length(), (occa::udim_t) 2);
+
+  ASSERT_THROW(
+    view.slice(4, 2);
+  );
+
+  // Kernel arguments point at the view offset
+  occa::kernelArg arg = view2;
+  ASSERT_EQ(arg[0].getModeMemory(), modeMemory);
+  ASSERT_EQ(arg[0].ptr(), (void*) (mem.ptr<float>() + 5));
+
+  // Copies are relative to the view
+  float values[2] = {-1, -2};
+  view2.copyFrom(values);
+  ASSERT_EQ(mem.ptr<float>()[5], (float) -1);
+  ASSERT_EQ(mem.ptr<float>()[6], (float) -2);
+
+  view2.copyTo(data, sizeof(float), sizeof(float));
+  ASSERT_EQ(data[0], (float) -2);
+
+  ASSERT_THROW(
+    view2.copyTo(data, 3 * sizeof(float));
+  );
+
+  // Reinterpreting the dtype
+  occa::memoryView bytes = view2.as(occa::dtype::byte);
+  ASSERT_EQ(bytes.length(), (occa::udim_t) (2 * sizeof(float)));
+  ASSERT_EQ(bytes.slice(sizeof(float)).ptr<float>()[0], (float) -2);
+
+  // Views convert to memory objects
+  occa::memory viewMem = view2;
+  ASSERT_NEQ(viewMem.getModeMemory(), modeMemory);
+  ASSERT_EQ(viewMem.size(), (occa::udim_t) (2 * sizeof(float)));
+  ASSERT_EQ(viewMem.ptr<float>(), mem.ptr<float>() + 5);
+  ASSERT_EQ(viewMem.dtype(), occa::dtype::float_);
+
+  occa::memoryView nullView;
+  ASSERT_FALSE(nullView.isInitialized());
+  ASSERT_FALSE(occa::memory(nullView).isInitialized());
+
+  delete [] data;
+}
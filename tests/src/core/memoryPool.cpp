@@ -0,0 +1,177 @@
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testBlockBytes();
+void testReuse();
+void testLargeBlocks();
+void testStreams();
+void testLimits();
+
+int main(const int argc, const char **argv) {
+  testBlockBytes();
+  testReuse();
+  testLargeBlocks();
+  testStreams();
+  testLimits();
+
+  return 0;
+}
+
+occa::device poolDevice(const std::string &poolProps = "") {
+  return occa::device(
+    "mode: 'Serial',"
+    "memory_pool: {"
+    "  enabled: true,"
+    + poolProps +
+    "}"
+  );
+}
+
+void testBlockBytes() {
+  occa::device device = poolDevice();
+  occa::memoryPool_t &pool = *(device.getModeDevice()->memoryPool);
+
+  ASSERT_EQ(pool.blockBytes(1), (occa::udim_t) 256);
+  ASSERT_EQ(pool.blockBytes(256), (occa::udim_t) 256);
+  ASSERT_EQ(pool.blockBytes(257), (occa::udim_t) 320);
+  ASSERT_EQ(pool.blockBytes(1000), (occa::udim_t) 1024);
+  ASSERT_EQ(pool.blockBytes(1025), (occa::udim_t) 1280);
+  ASSERT_EQ(pool.blockBytes(1 << 20), (occa::udim_t) (1 << 20));
+
+  // Large blocks are rounded up to large_block_bytes
+  ASSERT_EQ(pool.blockBytes((1 << 20) + 1), (occa::udim_t) (2 << 20));
+  ASSERT_EQ(pool.blockBytes(5 << 20), (occa::udim_t) (5 << 20));
+
+  // No pool unless enabled
+  occa::device noPoolDevice("mode: 'Serial'");
+  ASSERT_EQ(noPoolDevice.getModeDevice()->memoryPool,
+            (occa::memoryPool_t*) NULL);
+}
+
+void testReuse() {
+  occa::device device = poolDevice();
+
+  occa::memory mem = device.malloc(1000);
+  void *ptr = mem.ptr();
+  ASSERT_EQ(mem.size(), (occa::udim_t) 1000);
+  ASSERT_EQ(device.memoryAllocated(), (occa::udim_t) 1000);
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 0);
+
+  mem.free();
+  ASSERT_FALSE(mem.isInitialized());
+  ASSERT_EQ(device.memoryAllocated(), (occa::udim_t) 0);
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 1024);
+
+  // Same size class
+  int values[225];
+  for (int i = 0; i < 225; ++i) {
+    values[i] = i;
+  }
+  mem = device.malloc(225 * sizeof(int), values);
+  ASSERT_EQ(mem.ptr(), ptr);
+  ASSERT_EQ(mem.size(), (occa::udim_t) (225 * sizeof(int)));
+  ASSERT_EQ(mem.ptr<int>()[224], 224);
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 0);
+  ASSERT_EQ(device.memoryPoolHits(), (occa::udim_t) 1);
+  ASSERT_EQ(device.memoryPoolMisses(), (occa::udim_t) 1);
+
+  // Wrappers are NULLed when the block goes back to the pool
+  occa::memory mem2 = mem;
+  mem.free();
+  ASSERT_FALSE(mem2.isInitialized());
+
+  // Different memory properties don't share blocks
+  mem = device.malloc(1000, occa::properties("alignment: 256"));
+  ASSERT_EQ(device.memoryPoolMisses(), (occa::udim_t) 2);
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 1024);
+
+  // High-water mark
+  mem2 = device.malloc(2000);
+  ASSERT_EQ(device.memoryAllocated(), (occa::udim_t) 3000);
+  mem2.free();
+  ASSERT_EQ(device.memoryAllocated(), (occa::udim_t) 1000);
+  ASSERT_EQ(device.maxMemoryAllocated(), (occa::udim_t) 3000);
+
+  // Host pointers and UVA allocations aren't pooled
+  const occa::udim_t poolBytes = device.memoryPoolBytes();
+  mem2 = device.malloc(sizeof(values), values, "use_host_pointer: true");
+  ASSERT_EQ(mem2.ptr<int>(), values);
+  mem2.free();
+
+  void *uvaPtr = device.umalloc(1000);
+  occa::freeUvaPtr(uvaPtr);
+  ASSERT_EQ(device.memoryPoolBytes(), poolBytes);
+
+  device.trimMemoryPool();
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 0);
+
+  // Cached blocks are freed with the device
+  mem.free();
+  ASSERT_NEQ(device.memoryPoolBytes(), (occa::udim_t) 0);
+  device.free();
+}
+
+void testLargeBlocks() {
+  occa::device device = poolDevice();
+  const occa::udim_t MB = 1 << 20;
+
+  occa::memory mem = device.malloc(3 * MB);
+  void *ptr = mem.ptr();
+  mem.free();
+  ASSERT_EQ(device.memoryPoolBytes(), 3 * MB);
+
+  // Too much waste
+  mem = device.malloc(MB + 1);
+  ASSERT_NEQ(mem.ptr(), ptr);
+  mem.free();
+
+  // Best fit
+  mem = device.malloc(3 * MB - 100);
+  ASSERT_EQ(mem.ptr(), ptr);
+  ASSERT_EQ(device.memoryPoolBytes(), 2 * MB);
+  mem.free();
+}
+
+void testStreams() {
+  occa::device device = poolDevice();
+
+  occa::stream stream1 = device.createStream();
+  occa::stream stream2 = device.createStream();
+
+  device.setStream(stream1);
+  occa::memory mem = device.malloc(1000);
+  void *ptr = mem.ptr();
+  mem.free();
+
+  // Reused after stream1 finishes
+  device.setStream(stream2);
+  mem = device.malloc(1000);
+  ASSERT_EQ(mem.ptr(), ptr);
+  ASSERT_EQ(device.getStream(), stream2);
+  mem.free();
+
+  // Blocks outlive the stream they were freed on
+  device.setStream(stream1);
+  stream2.free();
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 1024);
+
+  mem = device.malloc(1000);
+  ASSERT_EQ(mem.ptr(), ptr);
+}
+
+void testLimits() {
+  occa::device device = poolDevice("max_cached_bytes: 2048,");
+
+  occa::memory mem1 = device.malloc(1000);
+  occa::memory mem2 = device.malloc(1000);
+  occa::memory mem3 = device.malloc(1000);
+  mem1.free();
+  mem2.free();
+  mem3.free();
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 2048);
+
+  // Opt out per allocation
+  mem1 = device.malloc(1000, occa::properties("pool: false"));
+  ASSERT_EQ(device.memoryPoolBytes(), (occa::udim_t) 2048);
+  ASSERT_EQ(mem1.getModeMemory()->poolBytes, (occa::udim_t) 0);
+}
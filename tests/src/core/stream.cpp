@@ -0,0 +1,167 @@
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+const std::string addOneSource = (
+  "@kernel void addOne(const int entries, int *values) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    values[i] += 1;\n"
+  "  }\n"
+  "}\n"
+);
+
+const std::string addPairSource = (
+  "@kernel void addPair(const int entries, const float2 pair, float *values) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    values[i] += pair.x + pair.y;\n"
+  "  }\n"
+  "}\n"
+);
+
+void testSyncStream();
+void testAsyncStream();
+void testMultipleAsyncStreams();
+void testAsyncValueArguments();
+
+int main(const int argc, const char **argv) {
+  testSyncStream();
+  testAsyncStream();
+  testMultipleAsyncStreams();
+  testAsyncValueArguments();
+
+  return 0;
+}
+
+void testSyncStream() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addOne = device.buildKernelFromString(addOneSource,
+                                                     "addOne");
+
+  const int entries = 10;
+  int values[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = i;
+  }
+
+  occa::memory o_values = device.malloc<int>(entries, values);
+
+  occa::streamTag startTag = device.tagStream();
+  addOne(entries, o_values);
+  occa::streamTag endTag = device.tagStream();
+
+  // Synchronous streams are done by the time the launch returns
+  int *ptr = (int*) o_values.ptr();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(i + 1, ptr[i]);
+  }
+
+  device.waitFor(endTag);
+  ASSERT_TRUE(device.timeBetween(startTag, endTag) >= 0);
+}
+
+void testAsyncStream() {
+  occa::device device("mode: 'Serial'");
+  occa::kernel addOne = device.buildKernelFromString(addOneSource,
+                                                     "addOne");
+
+  occa::stream asyncStream = device.createStream("async: true");
+  device.setStream(asyncStream);
+
+  const int entries = 1000;
+  int values[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = i;
+  }
+
+  occa::memory o_values = device.malloc<int>(entries, values);
+
+  occa::streamTag startTag = device.tagStream();
+  for (int i = 0; i < 10; ++i) {
+    addOne(entries, o_values);
+  }
+  occa::streamTag endTag = device.tagStream();
+
+  // Async copies run in order with the queued launches
+  int results[entries];
+  o_values.copyTo(results, "async: true");
+
+  device.waitFor(endTag);
+  ASSERT_TRUE(device.timeBetween(startTag, endTag) >= 0);
+
+  device.finish();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(i + 10, results[i]);
+  }
+
+  // Blocking copies wait on the queued launches
+  addOne(entries, o_values);
+  o_values.copyTo(results);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(i + 11, results[i]);
+  }
+
+  // Free with work still queued
+  addOne(entries, o_values);
+  addOne.free();
+  o_values.free();
+  asyncStream.free();
+}
+
+void testMultipleAsyncStreams() {
+  occa::device device("mode: 'Serial', stream: { async: true }");
+  occa::kernel addOne = device.buildKernelFromString(addOneSource,
+                                                     "addOne");
+
+  const int streamCount = 4;
+  const int entries = 1000;
+
+  occa::stream streams[streamCount];
+  occa::memory o_values[streamCount];
+  occa::streamTag tags[streamCount];
+
+  for (int s = 0; s < streamCount; ++s) {
+    streams[s] = device.createStream();
+    o_values[s] = device.malloc<int>(entries);
+    o_values[s].copyFrom(std::vector<int>(entries, s).data());
+  }
+
+  for (int s = 0; s < streamCount; ++s) {
+    device.setStream(streams[s]);
+    for (int i = 0; i <= s; ++i) {
+      addOne(entries, o_values[s]);
+    }
+    tags[s] = device.tagStream();
+  }
+
+  for (int s = 0; s < streamCount; ++s) {
+    device.waitFor(tags[s]);
+    const int *ptr = (const int*) o_values[s].ptr();
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(2*s + 1, ptr[i]);
+    }
+  }
+
+  device.free();
+}
+
+void testAsyncValueArguments() {
+  occa::device device("mode: 'Serial', stream: { async: true }");
+  occa::kernel addPair = device.buildKernelFromString(addPairSource,
+                                                      "addPair");
+
+  const int entries = 1000;
+  occa::memory o_values = device.malloc<float>(entries);
+  o_values.copyFrom(std::vector<float>(entries, 0).data());
+
+  // The float2 temporaries are gone before the queued launches run
+  for (int i = 0; i < 10; ++i) {
+    addPair(entries, occa::float2(i, 1), o_values);
+  }
+  device.finish();
+
+  const float *ptr = (const float*) o_values.ptr();
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(55, (int) ptr[i]);
+  }
+
+  device.free();
+}
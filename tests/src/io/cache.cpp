@@ -35,6 +35,10 @@ void testCacheInfoMethods() {
                 occa::env::OCCA_CACHE_DIR + "foo.okl"
               ));
   ASSERT_TRUE(occa::io::isCached(
+                occa::io::cachePath() + "foo.okl"
+              ));
+  // Cache directories from other hash versions
+  ASSERT_FALSE(occa::io::isCached(
                 occa::env::OCCA_CACHE_DIR + "cache/foo.okl"
               ));
 }
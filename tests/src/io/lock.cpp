@@ -1,4 +1,7 @@
+#include <fcntl.h>
 #include <stdlib.h>
+#include <sys/file.h>
+#include <thread>
 #include <time.h>
 #include <unistd.h>
 
@@ -9,6 +12,11 @@
 void testInit();
 void testAutoRelease();
 void testStaleRelease();
+void testFileLock();
+void testFileLockWakeup();
+void testFileLockNotStolen();
+void testFileLockCrashedHolder();
+void testFileLockNotInherited();
 void clearLocks();
 
 int main(const int argc, const char **argv) {
@@ -23,9 +31,18 @@ int main(const int argc, const char **argv) {
   clearLocks();
 
   testInit();
+
+  occa::settings()["locks/backend"] = "dir";
   testAutoRelease();
   testStaleRelease();
 
+  occa::settings()["locks/backend"] = "flock";
+  testFileLock();
+  testFileLockWakeup();
+  testFileLockNotStolen();
+  testFileLockCrashedHolder();
+  testFileLockNotInherited();
+
   clearLocks();
 
   return 0;
@@ -83,6 +100,107 @@ void testStaleRelease() {
   ASSERT_FALSE(occa::io::isDir(lock1.dir()));
 }
 
+void testFileLock() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock(hash, "tag");
+  ASSERT_EQ(lock.getBackend(),
+            occa::io::lockBackend::flock);
+  ASSERT_EQ(lock.dir(),
+            occa::env::OCCA_CACHE_DIR
+            + "locks/"
+            + hash.getString()
+            + "_tag.lock");
+  ASSERT_TRUE(lock.isMine());
+  ASSERT_TRUE(occa::io::isFile(lock.dir()));
+
+  lock.release();
+  ASSERT_FALSE(occa::io::isFile(lock.dir()));
+}
+
+void testFileLockWakeup() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock1(hash, "tag");
+  ASSERT_TRUE(lock1.isMine());
+
+  std::thread holder([&lock1]() {
+      ::usleep(50000);
+      lock1.release();
+    });
+
+  // Waiters are woken up by the release rather than polling
+  occa::io::lock_t lock2(hash, "tag");
+  const double startTime = occa::sys::currentTime();
+  ASSERT_FALSE(lock2.isMine());
+  ASSERT_LT(occa::sys::currentTime() - startTime,
+            0.5);
+
+  holder.join();
+}
+
+void testFileLockNotStolen() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock1(hash, "tag");
+  ASSERT_TRUE(lock1.isMine());
+
+  // Hold the lock past its stale age
+  std::thread holder([&lock1]() {
+      ::usleep(500000);
+      ASSERT_TRUE(occa::io::isFile(lock1.dir()));
+      lock1.release();
+    });
+
+  // Live holders keep their lock no matter how old it is
+  occa::io::lock_t lock2(hash, "tag");
+  const double startTime = occa::sys::currentTime();
+  ASSERT_FALSE(lock2.isMine());
+  ASSERT_GT(occa::sys::currentTime() - startTime,
+            0.4);
+
+  holder.join();
+  ASSERT_FALSE(occa::io::isFile(lock2.dir()));
+}
+
+void testFileLockCrashedHolder() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock(hash, "tag");
+
+  // Simulate a process that died while holding the lock
+  int fd = ::open(lock.dir().c_str(), O_RDWR | O_CREAT, 0666);
+  ASSERT_TRUE(fd >= 0);
+  ASSERT_EQ(::flock(fd, LOCK_EX | LOCK_NB), 0);
+  ::close(fd);
+
+  const double startTime = occa::sys::currentTime();
+  ASSERT_TRUE(lock.isMine());
+  ASSERT_LT(occa::sys::currentTime() - startTime,
+            0.5);
+
+  lock.release();
+}
+
+void testFileLockNotInherited() {
+  // Needs /proc to list the child's open files
+  if (!occa::io::isDir("/proc/self/fd")) {
+    return;
+  }
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock(hash, "tag");
+  ASSERT_TRUE(lock.isMine());
+
+  // Processes started while holding the lock don't inherit its fd
+  const std::string command = (
+    "ls -l /proc/$$/fd | grep -q '" + occa::io::basename(lock.dir()) + "'"
+  );
+  ASSERT_NEQ(::system(command.c_str()), 0);
+
+  lock.release();
+}
+
 void clearLocks() {
   occa::sys::rmdir(occa::env::OCCA_CACHE_DIR + "locks",
                    true);
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <stdlib.h>
 #include <time.h>
+#include <unistd.h>
 
 #include <occa/io.hpp>
 #include <occa/tools/env.hpp>
@@ -26,7 +27,7 @@ int main(const int argc, const char **argv) {
 
 void testPathMethods() {
   ASSERT_EQ(occa::io::cachePath(),
-            occa::env::OCCA_CACHE_DIR + "cache/");
+            occa::env::OCCA_CACHE_DIR + "cache/v" + occa::toString(OCCA_HASH_VERSION) + "/");
 
   ASSERT_EQ(occa::io::libraryPath(),
             occa::env::OCCA_CACHE_DIR + "libraries/");
@@ -145,8 +146,9 @@ void testDirMethods() {
             0);
   dirs = occa::io::directories(testDir);
   ASSERT_EQ((int) dirs.size(),
-            8);
+            9);
 
+  ASSERT_IN(testDir + "array/", dirs);
   ASSERT_IN(testDir + "c/", dirs);
   ASSERT_IN(testDir + "io/", dirs);
   ASSERT_IN(testDir + "lang/", dirs);
@@ -176,5 +178,24 @@ void testIOMethods() {
             content.size());
   delete [] c;
 
+  // Atomic writes
+  const std::string test_bar = occa::env::CWD + "test_bar";
+  occa::io::atomicWrite(test_bar, content);
+  ASSERT_EQ(occa::io::read(test_bar),
+            content);
+
+  // Failed renames throw and clean up the temporary file
+  const std::string test_dir = occa::env::CWD + "test_dir";
+  occa::io::write(test_dir + "/file", content);
+  ASSERT_THROW(
+    occa::io::atomicWrite(test_dir, content);
+  );
+  ASSERT_FALSE(occa::io::exists(test_dir
+                                + ".tmp"
+                                + occa::toString(::getpid())));
+
   occa::sys::rmrf(test_foo);
+  occa::sys::rmrf(test_bar);
+  occa::sys::rmrf(test_dir + "/file");
+  occa::sys::rmdir(test_dir);
 }
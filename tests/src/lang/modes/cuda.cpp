@@ -27,6 +27,7 @@ void testKernelArgs();
 void testSharedAnnotation();
 void testBarriers();
 void testAtomic();
+void testReduce();
 void testSource();
 
 int main(const int argc, const char **argv) {
@@ -37,6 +38,7 @@ int main(const int argc, const char **argv) {
   testKernelArgs();
   testSharedAnnotation();
   testBarriers();
+  testReduce();
   testSource();
 
   return 0;
@@ -78,6 +80,47 @@ void testAtomic() {
 }
 //======================================
 
+//---[ @reduce ]------------------------
+void testReduce() {
+  // Updates of reduced variables -> atomics
+  parseSource(
+    "@kernel void foo(const int N, const int *vec, int *sum, int *bits, int *partial) {\n"
+    "  for (int i = 0; i < N; ++i; @outer @reduce(\"+\", sum)) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      partial[4*i + j] = sum[0];\n"
+    "      sum[0] += vec[4*i + j];\n"
+    "    }\n"
+    "  }\n"
+    "  for (int i = 0; i < N; ++i; @outer @reduce(\"|\", bits)) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      bits[0] |= vec[4*i + j];\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  const std::string kernelSource = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("atomicAdd(&sum[0], vec[4 * i + j]);"));
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("atomicOr(&bits[0], vec[4 * i + j]);"));
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("partial[4 * i + j] = sum[0];"));
+
+  // No atomic lowering for min, max, *, && and ||
+  parseBadSource(
+    "@kernel void foo(const int N, const int *vec, int *maxValue) {\n"
+    "  for (int i = 0; i < N; ++i; @outer @reduce(\"max\", maxValue)) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      maxValue[0] = max(maxValue[0], vec[4*i + j]);\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+}
+//======================================
+
 //---[ Barriers ]-----------------------
 void testBarriers() {
   // Add barriers barrier(CLK_LOCAL_MEM_FENCE)
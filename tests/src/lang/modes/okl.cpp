@@ -1,5 +1,6 @@
 #include "../parserUtils.hpp"
 #include <occa/lang/modes/okl.hpp>
+#include <occa/lang/modes/oklForStatement.hpp>
 
 
 #define parseOKLSource(src_)                    \
@@ -15,6 +16,7 @@ void testKernel();
 void testLoops();
 void testTypes();
 void testLoopSkips();
+void testReductions();
 
 int main(const int argc, const char **argv) {
   parser.addAttribute<dummy>();
@@ -23,11 +25,13 @@ int main(const int argc, const char **argv) {
   parser.addAttribute<attributes::inner>();
   parser.addAttribute<attributes::shared>();
   parser.addAttribute<attributes::exclusive>();
+  parser.addAttribute<attributes::reduce>();
 
   testKernel();
   testLoops();
   testTypes();
   testLoopSkips();
+  testReductions();
 
   return 0;
 }
@@ -41,12 +45,14 @@ void testOKLLoopExists();
 void testProperOKLLoops();
 void testInnerInsideOuter();
 void testSameInnerLoopCount();
+void testIterationCount();
 
 void testLoops() {
   testOKLLoopExists();
   testProperOKLLoops();
   testInnerInsideOuter();
   testSameInnerLoopCount();
+  testIterationCount();
 }
 
 void testOKLLoopExists() {
@@ -163,6 +169,48 @@ void testSameInnerLoopCount() {
     "}\n"
   );
 }
+
+int getIterationCount(const std::string &loop) {
+  parseOKLSource(
+    "@kernel void foo() {\n"
+    "  for (" + loop + "; @outer) {\n"
+    "    for (int i = 0; i < 2; ++i; @inner) {}\n"
+    "  }\n"
+    "}\n"
+  );
+  statementArray outerSmnts = (
+    parser.root.children.flatFilterByAttribute("outer")
+  );
+  ASSERT_EQ(1,
+            (int) outerSmnts.length());
+
+  okl::oklForStatement oklForSmnt(outerSmnts[0]->to<forStatement>());
+  ASSERT_TRUE(oklForSmnt.isValid());
+
+  exprNode *count = oklForSmnt.getIterationCount();
+  const int value = (int) count->evaluate();
+  delete count;
+  return value;
+}
+
+void testIterationCount() {
+  ASSERT_EQ(10, getIterationCount("int o = 0; o < 10; ++o"));
+  ASSERT_EQ(11, getIterationCount("int o = 0; o <= 10; o++"));
+  ASSERT_EQ(7, getIterationCount("int o = 3; 10 > o; ++o"));
+
+  // Strided, the last iteration doesn't need to land on the bound
+  ASSERT_EQ(3, getIterationCount("int o = 0; o < 10; o += 4"));
+  ASSERT_EQ(3, getIterationCount("int o = 3; o < 10; o += 3"));
+  ASSERT_EQ(3, getIterationCount("int o = 3; o <= 9; o += 3"));
+
+  // Decrementing
+  ASSERT_EQ(10, getIterationCount("int o = 10; o > 0; --o"));
+  ASSERT_EQ(11, getIterationCount("int o = 10; o >= 0; o--"));
+  ASSERT_EQ(10, getIterationCount("int o = 10; 0 < o; --o"));
+  ASSERT_EQ(4, getIterationCount("int o = 10; o > 0; o -= 3"));
+  ASSERT_EQ(4, getIterationCount("int o = 9; o >= 0; o -= 3"));
+  ASSERT_EQ(3, getIterationCount("int o = 9; o > 0; o -= 3"));
+}
 //======================================
 
 //---[ Types ]--------------------------
@@ -305,3 +353,39 @@ void testValidContinues() {
   );
 }
 //======================================
+
+//---[ Reductions ]---------------------
+void testReductions() {
+  parseOKLSource(
+    "@kernel void foo(const int N, float *sum) {\n"
+    "  for (int o = 0; o < N; ++o; @outer @reduce(\"+\", sum)) {\n"
+    "    for (int i = 0; i < 2; ++i; @inner) {\n"
+    "      sum[0] += i;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  // Reduced variables are declared outside the loop
+  parseBadOKLSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int o = 0; o < N; ++o; @outer @reduce(\"+\", o)) {\n"
+    "    for (int i = 0; i < 2; ++i; @inner) {\n"
+    "      o += i;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  // @reduce only on @outer loops
+  parseBadOKLSource(
+    "@kernel void foo(const int N, float *sum) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 2; ++i; @inner @reduce(\"+\", sum)) {\n"
+    "      sum[0] += i;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+}
+//======================================
@@ -4,14 +4,19 @@
 #include "../parserUtils.hpp"
 
 void testPragma();
+void testThreadPool();
 void testAtomic();
+void testReduce();
 
 int main(const int argc, const char **argv) {
   parser.settings["okl/validate"] = false;
   parser.settings["serial/include_std"] = false;
+  parser.settings["simd/enabled"] = false;
 
   testPragma();
+  testThreadPool();
   testAtomic();
+  testReduce();
 
   return 0;
 }
@@ -40,6 +45,126 @@ void testPragma() {
     "}"
   );
   ASSERT_PRAGMA_EXISTS("omp parallel for", 1);
+
+  const std::string collapsibleSource = (
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < 2; ++k; @outer) {\n"
+    "      for (int j = 0; j < 4; ++j; @inner) {\n"
+    "        a[8*i + 4*k + j] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  // Clauses from kernel props
+  parser.settings["omp/schedule"] = "dynamic, 4";
+  parser.settings["omp/collapse"] = 3;
+  parser.settings["omp/proc_bind"] = "close";
+  parser.settings["omp/num_threads"] = 8;
+  parseSource(collapsibleSource);
+  // Only 2 @outer loops can be collapsed
+  ASSERT_PRAGMA_EXISTS("omp parallel for schedule(dynamic, 4) collapse(2)"
+                       " proc_bind(close) num_threads(8)", 1);
+
+  // @outer kwargs override kernel props
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"guided\", collapse=1, num_threads=N)) {\n"
+    "    for (int k = 0; k < 2; ++k; @outer) {\n"
+    "      for (int j = 0; j < 4; ++j; @inner) {\n"
+    "        a[8*i + 4*k + j] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp parallel for schedule(guided)"
+                       " proc_bind(close) num_threads(N)", 1);
+
+  parser.settings.remove("omp");
+}
+//======================================
+
+//---[ Thread Pool ]--------------------
+void testThreadPool() {
+  parser.settings["parallel_for"] = "thread_pool";
+
+  // @outer -> occa::parallelFor
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      a[4*i + j] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_EQ(0,
+            (int) parser.root.children
+            .flatFilterByStatementType(statementType::pragma)
+            .length());
+
+  std::string kernelSource = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("occa::parallelFor(_occa_outer_count_0,"));
+  ASSERT_EQ(std::string::npos,
+            kernelSource.find("_occa_outer_count_1"));
+  // Included even without serial/include_std
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("#include <occa/tools/workStealingPool.hpp>"));
+
+  // Collapse nested @outer loops
+  parser.settings["thread_pool/collapse"] = 2;
+  parser.settings["thread_pool/chunk_size"] = 8;
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < 2; ++k; @outer) {\n"
+    "      for (int j = 0; j < 4; ++j; @inner) {\n"
+    "        a[8*i + 4*k + j] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  kernelSource = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("occa::parallelFor(_occa_outer_count_0 * _occa_outer_count_1,"));
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("8,"));
+
+  // Iterators of every merged loop are still declared
+  parser.settings["thread_pool/collapse"] = 3;
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < 2; ++k; @outer) {\n"
+    "      for (int l = 3; l >= 0; --l; @outer) {\n"
+    "        for (int j = 0; j < 4; ++j; @inner) {\n"
+    "          a[32*i + 16*k + 4*l + j] = 0;\n"
+    "        }\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  kernelSource = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("occa::parallelFor(_occa_outer_count_0 * _occa_outer_count_1 * _occa_outer_count_2,"));
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("int i = "));
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("int k = "));
+  ASSERT_NEQ(std::string::npos,
+             kernelSource.find("int l = "));
+
+  parser.settings.remove("thread_pool");
+  parser.settings["parallel_for"] = "omp";
 }
 //======================================
 
@@ -51,10 +176,16 @@ void testAtomic() {
   );
   ASSERT_PRAGMA_EXISTS("omp atomic", 1);
 
+  parseSource(
+    "int i;\n"
+    "@atomic i *= 2;\n"
+  );
+  ASSERT_PRAGMA_EXISTS("omp atomic", 1);
+
   parseSource(
     "@atomic i < 1;\n"
   );
-  ASSERT_PRAGMA_EXISTS("omp critical", 1);
+  ASSERT_PRAGMA_EXISTS("omp critical(_occa_atomic_0)", 1);
 
   parseSource(
     "int i;\n"
@@ -64,13 +195,90 @@ void testAtomic() {
   );
   ASSERT_PRAGMA_EXISTS("omp atomic", 1);
 
+  // Sequence of updates -> one atomic per update
   parseSource(
-    "int i;\n"
+    "int i, j;\n"
     "@atomic {\n"
     "  i += 1;\n"
-    "  i += 1;\n"
+    "  j -= 1;\n"
     "}\n"
   );
-  ASSERT_PRAGMA_EXISTS("omp critical", 1);
+  ASSERT_PRAGMA_EXISTS("omp atomic", 2);
+
+  // Each general @atomic block gets its own critical section
+  parseSource(
+    "@kernel void foo(float *a) {\n"
+    "  for (int i = 0; i < 10; ++i; @outer) {\n"
+    "    @atomic {\n"
+    "      a[0] = a[1] + a[i];\n"
+    "    }\n"
+    "    @atomic {\n"
+    "      a[1] = a[0] * a[i];\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  statementArray pragmaStatements = (
+    parser.root.children
+    .flatFilterByStatementType(statementType::pragma)
+  );
+  ASSERT_EQ(3,
+            (int) pragmaStatements.length());
+  ASSERT_EQ("omp critical(_occa_atomic_foo_0)",
+            pragmaStatements[1]->to<pragmaStatement>().value());
+  ASSERT_EQ("omp critical(_occa_atomic_foo_1)",
+            pragmaStatements[2]->to<pragmaStatement>().value());
+}
+//======================================
+
+//---[ @reduce ]------------------------
+void testReduce() {
+  const std::string reduceSource = (
+    "@kernel void foo(const int N, const float *vec, float *sum, int *count) {\n"
+    "  for (int i = 0; i < N; ++i; @outer @reduce(\"+\", sum, count)) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      sum[0] += vec[4*i + j];\n"
+    "      ++count[0];\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  // @reduce -> reduction clause
+  parseSource(reduceSource);
+  ASSERT_PRAGMA_EXISTS("omp parallel for reduction(+: sum[0:1], count[0:1])", 1);
+
+  parseSource(
+    "@kernel void foo(const int N, float *a, float *maxValue) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < N; ++k; @outer @reduce(\"max\", maxValue)) {\n"
+    "      for (int j = 0; j < 4; ++j; @inner) {\n"
+    "        maxValue[0] = (a[j] > maxValue[0]) ? a[j] : maxValue[0];\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp parallel for reduction(max: maxValue[0:1])", 1);
+
+  // Thread pool -> atomic updates
+  parser.settings["parallel_for"] = "thread_pool";
+  parseSource(reduceSource);
+  ASSERT_PRAGMA_EXISTS("omp atomic", 2);
+
+  // Reading reduced variables isn't made atomic
+  parseSource(
+    "@kernel void foo(const int N, const float *vec, float *sum, float *partial) {\n"
+    "  for (int i = 0; i < N; ++i; @outer @reduce(\"+\", sum)) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      partial[4*i + j] = sum[0] * 2;\n"
+    "      sum[0] += vec[4*i + j];\n"
+    "      (*sum) -= partial[4*i + j];\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp atomic", 2);
+  parser.settings.remove("parallel_for");
 }
 //======================================
@@ -7,6 +7,8 @@ void testPreprocessor();
 void testKernel();
 void testExclusives();
 void testAtomic();
+void testSimd();
+void testPrelude();
 
 int main(const int argc, const char **argv) {
   parser.settings["serial/include_std"] = false;
@@ -18,9 +20,30 @@ int main(const int argc, const char **argv) {
   // parser.settings["okl/validate"] = true;
   // testExclusives();
 
+  parser.settings["okl/validate"] = true;
+  testSimd();
+  testPrelude();
+
   return 0;
 }
 
+#define ASSERT_PRAGMA_EXISTS(PRAGMA_SOURCE, COUNT)                      \
+  do {                                                                  \
+    statementArray pragmaStatements = (                                 \
+      parser.root.children                                              \
+      .flatFilterByStatementType(statementType::pragma)                 \
+    );                                                                  \
+                                                                        \
+    ASSERT_EQ(COUNT,                                                    \
+              (int) pragmaStatements.length());                         \
+                                                                        \
+    if (COUNT) {                                                        \
+      pragmaStatement &pragma = pragmaStatements[0]->to<pragmaStatement>(); \
+      ASSERT_EQ(PRAGMA_SOURCE,                                          \
+                pragma.value());                                        \
+    }                                                                   \
+  } while(0)
+
 //---[ Preprocessor ]-------------------
 void testPreprocessor() {
   // @restrict -> __restrict__
@@ -134,3 +157,103 @@ void testAtomic() {
   // TODO(dmed)
 }
 //======================================
+
+//---[ SIMD ]---------------------------
+void testSimd() {
+  // Only the inner-most @inner loop is vectorized
+  parseSource(
+    "@kernel void foo(const int N, @restrict float *a, const float *b) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 4; ++i; @inner) {\n"
+    "      for (int j = 0; j < 16; ++j; @inner) {\n"
+    "        a[16*i + j] = b[16*i + j];\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp simd", 1);
+
+  // Clauses
+  parser.settings["simd/safelen"] = 8;
+  parser.settings["simd/aligned"] = 64;
+  parseSource(
+    "@kernel void foo(const int N, @restrict float *a, @restrict float *c, const float *b) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      a[i] = b[i] + a[i];\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp simd safelen(8) aligned(a: 64)", 1);
+  parser.settings.remove("simd");
+
+  // Atomics and early exits are not vectorized
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      @atomic a[0] += a[i];\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("", 0);
+
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      if (a[i] < 0) return;\n"
+    "      a[i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("", 0);
+
+  // Disabled
+  parser.settings["simd/enabled"] = false;
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      a[i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("", 0);
+  parser.settings.remove("simd");
+}
+//======================================
+
+//---[ Prelude ]------------------------
+void testPrelude() {
+  const std::string kernelSource = (
+    "@kernel void foo() {\n"
+    "  for (int i = 0; i < 10; ++i; @outer) {\n"
+    "    for (int j = 0; j < 10; ++j; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+
+  parseSource(kernelSource);
+  ASSERT_NEQ(std::string::npos,
+             parser.toString().find("#include <occa.hpp>"));
+
+  // The prelude replaces the standard includes
+  parser.settings["serial/prelude"] = "/path/to/prelude.hpp";
+  parseSource(kernelSource);
+  const std::string output = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             output.find("#include \"/path/to/prelude.hpp\""));
+  ASSERT_EQ(std::string::npos,
+            output.find("#include <occa.hpp>"));
+  ASSERT_NEQ(std::string::npos,
+             output.find("using namespace occa;"));
+
+  parser.settings.remove("serial/prelude");
+}
+//======================================
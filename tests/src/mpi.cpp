@@ -0,0 +1,119 @@
+#include <occa.hpp>
+#include <occa/mpi.hpp>
+#include <occa/tools/testing.hpp>
+
+std::string nodeCacheDir(const int node);
+void testNodes();
+void testBuildKernel(const std::string &kernelCache);
+
+int main(int argc, char **argv) {
+  MPI_Init(&argc, &argv);
+
+  // Emulate nodes with 2 ranks each and their own cache directory
+  occa::settings()["mpi/ranks_per_node"] = 2;
+  if (occa::mpi::id() == 0) {
+    occa::sys::rmdir(nodeCacheDir(-1), true);
+  }
+  occa::mpi::barrier();
+  occa::env::OCCA_CACHE_DIR = nodeCacheDir(occa::mpi::id() / 2);
+
+  testNodes();
+  testBuildKernel("shared");
+  testBuildKernel("broadcast");
+  testBuildKernel("node");
+
+  occa::mpi::barrier();
+  MPI_Finalize();
+
+  return 0;
+}
+
+std::string nodeCacheDir(const int node) {
+  static const std::string baseCacheDir = occa::env::OCCA_CACHE_DIR + "mpi/";
+  if (node < 0) {
+    return baseCacheDir;
+  }
+  return baseCacheDir + "node" + occa::toString(node) + "/";
+}
+
+void testNodes() {
+  const int id = occa::mpi::id();
+  const int size = occa::mpi::size();
+
+  ASSERT_EQ(occa::mpi::nodeId(),
+            id % 2);
+  ASSERT_EQ(occa::mpi::nodeSize(),
+            std::min(2, size - (id - (id % 2))));
+  ASSERT_EQ(occa::mpi::isNodeLeader(),
+            (id % 2) == 0);
+  ASSERT_EQ(occa::mpi::nodeLeaderComm() == MPI_COMM_NULL,
+            !occa::mpi::isNodeLeader());
+}
+
+void testBuildKernel(const std::string &kernelCache) {
+  occa::settings()["mpi/kernel_cache"] = kernelCache;
+
+  occa::device device("mode: 'Serial'");
+
+  // Use a different hash for each setting
+  const std::string source = (
+    "// " + kernelCache + "\n"
+    "@kernel void addVectors(const int entries,\n"
+    "                        const float *a,\n"
+    "                        const float *b,\n"
+    "                        float *ab) {\n"
+    "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+    "    ab[i] = a[i] + b[i];\n"
+    "  }\n"
+    "}\n"
+  );
+
+  occa::kernel addVectors = occa::mpi::buildKernelFromString(device,
+                                                             source,
+                                                             "addVectors");
+  ASSERT_TRUE(addVectors.isInitialized());
+
+  const int entries = 10;
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+    b[i] = occa::mpi::id();
+    ab[i] = 0;
+  }
+  occa::memory o_a = device.malloc(entries * sizeof(float), a);
+  occa::memory o_b = device.malloc(entries * sizeof(float), b);
+  occa::memory o_ab = device.malloc(entries * sizeof(float));
+
+  addVectors(entries, o_a, o_b, o_ab);
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], a[i] + b[i]);
+  }
+
+  // Check each node's cache after every rank has loaded the kernel
+  occa::mpi::barrier();
+
+  const std::string binaryFile = occa::io::basename(addVectors.binaryFilename());
+  const std::string hashDir = (
+    occa::io::dirname(addVectors.binaryFilename())
+    .substr(occa::io::cachePath().size())
+  );
+  const std::string rootBuildFile = (
+    nodeCacheDir(0) + "cache/v" + occa::toString(OCCA_HASH_VERSION) + "/"
+    + hashDir + occa::kc::buildFile
+  );
+  const std::string buildFile = (
+    occa::io::cachePath() + hashDir + occa::kc::buildFile
+  );
+
+  ASSERT_TRUE(occa::io::isFile(occa::io::cachePath() + hashDir + binaryFile));
+  ASSERT_TRUE(occa::io::cachedFileIsComplete(occa::io::cachePath() + hashDir,
+                                             binaryFile));
+  if (kernelCache == "broadcast") {
+    // Other nodes should be using the files built by rank 0
+    ASSERT_EQ(occa::io::read(buildFile),
+              occa::io::read(rootBuildFile));
+  }
+
+  occa::mpi::barrier();
+}
@@ -0,0 +1,98 @@
+#include <fstream>
+
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testHash();
+void testHasher();
+void testHashFile();
+
+int main(const int argc, const char **argv) {
+  testHash();
+  testHasher();
+  testHashFile();
+
+  return 0;
+}
+
+void testHash() {
+  ASSERT_TRUE(occa::hash("").isInitialized());
+  ASSERT_FALSE(occa::hash_t().isInitialized());
+
+  ASSERT_EQ(occa::hash("foo"),
+            occa::hash(std::string("foo")));
+  ASSERT_NEQ(occa::hash("foo"),
+             occa::hash("fop"));
+
+  // Trailing zeros still change the hash
+  const char bytes[4] = {'a', 'b', 0, 0};
+  ASSERT_NEQ(occa::hash(bytes, 2),
+             occa::hash(bytes, 3));
+  ASSERT_NEQ(occa::hash(bytes, 3),
+             occa::hash(bytes, 4));
+
+  // Single bit flips past the first block
+  std::string source(5000, 'a');
+  const occa::hash_t sourceHash = occa::hash(source);
+  source[4321] = 'b';
+  ASSERT_NEQ(sourceHash,
+             occa::hash(source));
+
+  ASSERT_EQ(16, (int) sourceHash.getString().size());
+  ASSERT_EQ(64, (int) sourceHash.getFullString().size());
+  ASSERT_EQ(sourceHash,
+            occa::hash_t::fromString(sourceHash.getFullString()));
+}
+
+void testHasher() {
+  std::string source;
+  for (int i = 0; i < 3000; ++i) {
+    source += (char) (i * 7);
+  }
+  const occa::hash_t sourceHash = occa::hash(source);
+
+  // Any split of the input gives the same hash
+  const int splits[] = {1, 3, 63, 64, 65, 1024, 1025};
+  for (int s = 0; s < 7; ++s) {
+    occa::hasher_t hasher;
+    const int step = splits[s];
+    for (int i = 0; i < (int) source.size(); i += step) {
+      hasher.update(source.c_str() + i,
+                    std::min(step, (int) source.size() - i));
+    }
+    ASSERT_EQ(sourceHash,
+              hasher.digest());
+  }
+
+  occa::hasher_t hasher;
+  hasher.update("foo");
+  // Digesting doesn't stop the hasher
+  ASSERT_EQ(occa::hash("foo"),
+            hasher.digest());
+  hasher.update(std::string("bar"));
+  ASSERT_EQ(occa::hash("foobar"),
+            hasher.digest());
+
+  hasher.clear();
+  ASSERT_EQ(occa::hash(""),
+            hasher.digest());
+}
+
+void testHashFile() {
+  const std::string filename = occa::env::OCCA_CACHE_DIR + "hash_test_file";
+
+  std::string content = "before";
+  content += '\0';
+  content += "after";
+  std::ofstream file(filename.c_str(), std::ios::binary);
+  file.write(content.c_str(), content.size());
+  file.close();
+
+  // Hashing doesn't stop at the NUL character
+  ASSERT_EQ(occa::hash(content),
+            occa::hashFile(filename));
+  ASSERT_NEQ(occa::hash("before"),
+             occa::hashFile(filename));
+
+  occa::sys::rmrf(filename);
+}
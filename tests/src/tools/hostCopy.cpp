@@ -0,0 +1,128 @@
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testMemcpy();
+void testMemset();
+void testFirstTouch();
+void testOpenMPMemory();
+
+int main(const int argc, const char **argv) {
+  testMemcpy();
+  testMemset();
+  testFirstTouch();
+  testOpenMPMemory();
+
+  return 0;
+}
+
+// Serial, parallel and non-temporal copies with unaligned ends
+static const int sizeCount = 5;
+static const occa::udim_t sizes[sizeCount] = {
+  0,
+  1000,
+  occa::hostCopy::parallelBytes - 1,
+  occa::hostCopy::parallelBytes + 4097,
+  occa::hostCopy::nonTemporalBytes + 77
+};
+
+void testMemcpy() {
+  const occa::udim_t maxBytes = sizes[sizeCount - 1] + 16;
+  char *src  = new char[maxBytes];
+  char *dest = new char[maxBytes];
+
+  for (occa::udim_t i = 0; i < maxBytes; ++i) {
+    src[i] = (char) (7 * i);
+  }
+
+  for (int i = 0; i < sizeCount; ++i) {
+    const occa::udim_t bytes = sizes[i];
+    ::memset(dest, 0, maxBytes);
+
+    occa::hostMemcpy(dest + 3, src + 1, bytes);
+
+    ASSERT_EQ(dest[2], (char) 0);
+    ASSERT_EQ(dest[3 + bytes], (char) 0);
+    ASSERT_EQ(::memcmp(dest + 3, src + 1, bytes), 0);
+  }
+
+  delete [] src;
+  delete [] dest;
+}
+
+void testMemset() {
+  const occa::udim_t maxBytes = sizes[sizeCount - 1] + 16;
+  char *dest = new char[maxBytes];
+  char *expected = new char[maxBytes];
+  ::memset(expected, 0x5A, maxBytes);
+
+  for (int i = 0; i < sizeCount; ++i) {
+    const occa::udim_t bytes = sizes[i];
+    ::memset(dest, 0, maxBytes);
+
+    occa::hostMemset(dest + 5, 0x5A, bytes);
+
+    ASSERT_EQ(dest[4], (char) 0);
+    ASSERT_EQ(dest[5 + bytes], (char) 0);
+    ASSERT_EQ(::memcmp(dest + 5, expected, bytes), 0);
+  }
+
+  delete [] dest;
+  delete [] expected;
+}
+
+void testFirstTouch() {
+  const occa::udim_t bytes = 2 * occa::hostCopy::parallelBytes + 123;
+  char *ptr = (char*) occa::sys::malloc(bytes);
+
+  occa::hostFirstTouch(ptr, bytes);
+  occa::hostMemset(ptr, 1, bytes);
+  ASSERT_EQ(ptr[0], (char) 1);
+  ASSERT_EQ(ptr[bytes - 1], (char) 1);
+
+  occa::sys::free(ptr);
+}
+
+void testOpenMPMemory() {
+  const int entries = (int) (occa::hostCopy::parallelBytes / sizeof(int)) + 100;
+  int *values = new int[entries];
+  for (int i = 0; i < entries; ++i) {
+    values[i] = i;
+  }
+
+  // Serial copies stay on the calling thread unless asked for
+  occa::device serialDevice("mode: 'Serial'");
+  occa::memory mem = serialDevice.malloc<int>(entries, values);
+  ASSERT_FALSE(mem.properties().get("parallel_copies", false));
+
+  mem = serialDevice.malloc<int>(entries,
+                                 occa::properties("parallel_copies: true"));
+  mem.copyFrom(values);
+  ASSERT_EQ(mem.ptr<int>()[entries - 1], entries - 1);
+
+  if (!occa::modeIsEnabled("OpenMP")) {
+    delete [] values;
+    return;
+  }
+
+  occa::device device("mode: 'OpenMP'");
+  mem = device.malloc<int>(entries);
+  ASSERT_TRUE(mem.properties().get("parallel_copies", false));
+  ASSERT_TRUE(mem.properties().get("first_touch", false));
+
+  mem.copyFrom(values);
+  ASSERT_EQ(mem.ptr<int>()[0], 0);
+  ASSERT_EQ(mem.ptr<int>()[entries - 1], entries - 1);
+
+  int *copies = new int[entries];
+  mem.copyTo(copies);
+  ASSERT_EQ(::memcmp(copies, values, entries * sizeof(int)), 0);
+
+  // Opt out per allocation
+  mem = device.malloc<int>(entries, values,
+                           occa::properties("parallel_copies: false"));
+  ASSERT_FALSE(mem.properties().get("parallel_copies", true));
+  ASSERT_EQ(mem.ptr<int>()[entries - 1], entries - 1);
+
+  delete [] values;
+  delete [] copies;
+}
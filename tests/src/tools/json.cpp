@@ -17,6 +17,8 @@ void testSize();
 void testTruthyValues();
 void testComparisons();
 void testConversions();
+void testCopyOnWrite();
+void testHash();
 void testErrors();
 
 int main(const int argc, const char **argv) {
@@ -32,6 +34,8 @@ int main(const int argc, const char **argv) {
   testTruthyValues();
   testComparisons();
   testConversions();
+  testCopyOnWrite();
+  testHash();
   testErrors();
 
   return 0;
@@ -486,6 +490,162 @@ void testConversions() {
             (double) j["null"]);
 }
 
+void testCopyOnWrite() {
+  occa::json a = occa::json::parse(
+    "{"
+    "  string: 'a',"
+    "  array: [1, 2],"
+    "  object: { a: 1, b: { c: 2 } },"
+    "}"
+  );
+  occa::json b = a;
+  ASSERT_EQ(a, b);
+
+  // Copies don't see each other's changes
+  b["string"] += "b";
+  b["array"] += 3;
+  b["object/b/c"] = 3;
+  b["object/d"] = 4;
+
+  ASSERT_EQ("a",
+            a["string"].string());
+  ASSERT_EQ("ab",
+            b["string"].string());
+  ASSERT_EQ(2,
+            a["array"].size());
+  ASSERT_EQ(3,
+            b["array"].size());
+  ASSERT_EQ(2,
+            a.get<int>("object/b/c"));
+  ASSERT_EQ(3,
+            b.get<int>("object/b/c"));
+  ASSERT_FALSE(a.has("object/d"));
+  ASSERT_TRUE(b.has("object/d"));
+
+  // Accessors unshare the value
+  occa::json c = a;
+  c["object"].object().erase("a");
+  c.array().size();
+  ASSERT_TRUE(a.has("object/a"));
+  ASSERT_TRUE(c.isArray());
+  ASSERT_TRUE(a.isObject());
+
+  // Removing an entry doesn't modify other copies
+  occa::json d = a;
+  d.remove("object/b/c");
+  ASSERT_TRUE(a.has("object/b/c"));
+  ASSERT_FALSE(d.has("object/b/c"));
+
+  // Merging into an empty object shares the value
+  occa::json e(occa::json::object_);
+  e += a;
+  ASSERT_EQ(a, e);
+  e["string"] = "e";
+  ASSERT_EQ("a",
+            a["string"].string());
+
+  // Assigning a child value
+  occa::json f = a;
+  f = f["object"];
+  ASSERT_EQ(1,
+            f.get<int>("a"));
+
+  // Adding an array to itself
+  occa::json g = occa::json::parse("[1]");
+  g += g;
+  ASSERT_EQ(2,
+            g.size());
+  ASSERT_EQ(1,
+            g[1].size());
+
+  // Copies made while references are held don't see changes through them
+  occa::json h = occa::json::parse("{ x: 1, y: { z: 1 } }");
+  occa::json &hx = h["x"];
+  occa::json &hz = h["y/z"];
+  occa::json i = h;
+  hx = 2;
+  hz = 2;
+  ASSERT_EQ(1,
+            i.get<int>("x"));
+  ASSERT_EQ(1,
+            i.get<int>("y/z"));
+  ASSERT_EQ(2,
+            h.get<int>("x"));
+  ASSERT_EQ(2,
+            h.get<int>("y/z"));
+
+  occa::jsonObject &hy = h["y"].object();
+  occa::json j = h;
+  hy["w"] = 3;
+  ASSERT_FALSE(j.has("y/w"));
+  ASSERT_TRUE(h.has("y/w"));
+
+  occa::json k = "k";
+  std::string &kString = k.string();
+  occa::json l = k;
+  kString += "k";
+  ASSERT_EQ("k",
+            l.string());
+  ASSERT_EQ("kk",
+            k.string());
+}
+
+void testHash() {
+  occa::json a = occa::json::parse(
+    "{"
+    "  string: 'a',"
+    "  array: [1, 'a', { b: true }],"
+    "  object: { a: 1, b: { c: null } },"
+    "}"
+  );
+  occa::json b = occa::json::parse(a.dump());
+  const occa::hash_t hash = a.hash();
+
+  // Equal values hash the same
+  ASSERT_EQ(hash, b.hash());
+  ASSERT_EQ(hash, a.hash());
+
+  // Values with the same dump but different types don't
+  ASSERT_NEQ(occa::json("1").hash(),
+             occa::json(1).hash());
+  ASSERT_NEQ(occa::json::parse("['ab']").hash(),
+             occa::json::parse("['a', 'b']").hash());
+
+  // Modifying the value updates the hash
+  b["object/b/c"] = 1;
+  ASSERT_NEQ(hash, b.hash());
+  b["object/b/c"].asNull();
+  ASSERT_EQ(hash, b.hash());
+
+  b["array"][2]["b"] = false;
+  ASSERT_NEQ(hash, b.hash());
+  b["array"][2]["b"] = true;
+  ASSERT_EQ(hash, b.hash());
+
+  b.object().erase("string");
+  ASSERT_NEQ(hash, b.hash());
+
+  // Copies keep their own hash
+  occa::json c = a;
+  c["string"] += "c";
+  ASSERT_EQ(hash, a.hash());
+  ASSERT_NEQ(hash, c.hash());
+
+  // Changes through references to nested values update the hash
+  occa::json props = occa::json::parse("{ okl: { enabled: true } }");
+  occa::json &okl = props["okl"];
+  const occa::hash_t propsHash = props.hash();
+  okl["enabled"] = false;
+  ASSERT_NEQ(propsHash, props.hash());
+  okl["enabled"] = true;
+  ASSERT_EQ(propsHash, props.hash());
+
+  // Copies made from them still cache their hash
+  occa::json propsCopy = props;
+  ASSERT_EQ(propsHash, propsCopy.hash());
+  ASSERT_EQ(propsHash, propsCopy.hash());
+}
+
 void testErrors() {
   // Unknown type
   ASSERT_THROW(
@@ -1,13 +1,23 @@
 #include <occa/tools/testing.hpp>
 
 #include <occa.hpp>
+#include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/memory.hpp>
 
 void testPtrRange();
+void testPtrRangeIndex();
+void testStaleMemoryList();
+void testDirtyRangeSet();
+void testDirtyRangeSync();
 void testUva();
 void testUvaNull();
 
 int main(const int argc, const char **argv) {
   testPtrRange();
+  testPtrRangeIndex();
+  testStaleMemoryList();
+  testDirtyRangeSet();
+  testDirtyRangeSync();
   testUva();
   testUvaNull();
 
@@ -64,6 +74,290 @@ void testPtrRange() {
   std::cout << "Testing ptrRange output: " << range << '\n';
 }
 
+void testPtrRangeIndex() {
+  occa::ptrRangeIndex index;
+  occa::modeMemory_t *mem1 = (occa::modeMemory_t*) 1;
+  occa::modeMemory_t *mem2 = (occa::modeMemory_t*) 2;
+
+  char *base = (char*) (((size_t) 1) << 32);
+  const size_t chunkBytes = ((size_t) 1) << occa::ptrRangeIndex::chunkShift;
+
+  // Small range
+  index.insert(occa::ptrRange(base + 16, 32), mem1);
+  ASSERT_EQ(index.find(base + 16), mem1);
+  ASSERT_EQ(index.find(base + 47), mem1);
+  ASSERT_EQ(index.find(base + 48), (occa::modeMemory_t*) NULL);
+  ASSERT_EQ(index.find(base + 15), (occa::modeMemory_t*) NULL);
+  ASSERT_EQ(index.find(NULL), (occa::modeMemory_t*) NULL);
+
+  // Range covering more chunks than there are shards
+  char *start = base + chunkBytes - 8;
+  const size_t bytes = 100 * chunkBytes;
+  index.insert(occa::ptrRange(start, bytes), mem2);
+  for (size_t offset = 0; offset < bytes; offset += (chunkBytes / 3)) {
+    ASSERT_EQ(index.find(start + offset), mem2);
+  }
+  ASSERT_EQ(index.find(start + bytes - 1), mem2);
+  ASSERT_EQ(index.find(start + bytes), (occa::modeMemory_t*) NULL);
+  ASSERT_EQ(index.find(base + 16), mem1);
+
+  // Erase through any pointer in the range
+  index.erase(start + (bytes / 2));
+  for (size_t offset = 0; offset < bytes; offset += (chunkBytes / 3)) {
+    ASSERT_EQ(index.find(start + offset), (occa::modeMemory_t*) NULL);
+  }
+  ASSERT_EQ(index.find(base + 16), mem1);
+
+  index.erase(base + 20);
+  ASSERT_EQ(index.find(base + 16), (occa::modeMemory_t*) NULL);
+
+  // Erasing unknown pointers is a no-op
+  index.erase(base);
+}
+
+void testStaleMemoryList() {
+  occa::device device("mode: 'Serial'");
+  occa::memory mem1 = device.malloc(10);
+  occa::memory mem2 = device.malloc(10);
+  occa::memory mem3 = device.malloc(10);
+  occa::modeMemory_t *modeMem1 = mem1.getModeMemory();
+  occa::modeMemory_t *modeMem2 = mem2.getModeMemory();
+  occa::modeMemory_t *modeMem3 = mem3.getModeMemory();
+
+  occa::staleMemoryList list;
+  ASSERT_TRUE(list.isEmpty());
+
+  list.push(modeMem1);
+  list.push(modeMem2);
+  list.push(modeMem3);
+  // Pushing twice is a no-op
+  list.push(modeMem2);
+  ASSERT_FALSE(list.isEmpty());
+  ASSERT_TRUE(list.contains(modeMem1));
+  ASSERT_TRUE(list.contains(modeMem2));
+  ASSERT_TRUE(list.contains(modeMem3));
+
+  list.remove(modeMem2);
+  ASSERT_FALSE(list.contains(modeMem2));
+  list.remove(modeMem2);
+
+  ASSERT_EQ(list.pop(), modeMem3);
+  ASSERT_EQ(list.pop(), modeMem1);
+  ASSERT_EQ(list.pop(), (occa::modeMemory_t*) NULL);
+  ASSERT_TRUE(list.isEmpty());
+
+  // Freed memory is removed from its device's stale list
+  device.getModeDevice()->uvaStaleMemory.push(modeMem1);
+  mem1.free();
+  ASSERT_TRUE(device.getModeDevice()->uvaStaleMemory.isEmpty());
+}
+
+void testDirtyRangeSet() {
+  typedef occa::dirtyRangeSet::range_t range_t;
+
+  occa::dirtyRangeSet ranges;
+  ASSERT_TRUE(ranges.isEmpty());
+
+  ranges.add(10, 10);
+  ranges.add(30, 10);
+  ranges.add(5, 0);
+  ASSERT_EQ(ranges.rangeCount(), 2);
+  ASSERT_EQ(ranges.bytes(), (occa::udim_t) 20);
+
+  // Adjacent
+  ranges.add(20, 5);
+  ASSERT_EQ(ranges.rangeCount(), 2);
+  ASSERT_EQ(ranges.bytes(), (occa::udim_t) 25);
+
+  // Overlapping both
+  ranges.add(15, 20);
+  ASSERT_EQ(ranges.rangeCount(), 1);
+  ASSERT_EQ(ranges.bytes(), (occa::udim_t) 30);
+
+  ranges.add(50, 10);
+  ranges.add(70, 10);
+
+  // Take [12, 55) -> [12, 40) + [50, 55)
+  occa::dirtyRangeSet::rangeVector taken;
+  ranges.take(12, 43, taken);
+  ASSERT_EQ((int) taken.size(), 2);
+  ASSERT_TRUE(taken[0] == range_t(12, 40));
+  ASSERT_TRUE(taken[1] == range_t(50, 55));
+
+  // Left: [10, 12), [55, 60), [70, 80)
+  ASSERT_EQ(ranges.rangeCount(), 3);
+  ASSERT_EQ(ranges.bytes(), (occa::udim_t) 17);
+
+  taken.clear();
+  ranges.take(60, 10, taken);
+  ASSERT_EQ((int) taken.size(), 0);
+
+  ranges.take(0, 100, taken);
+  ASSERT_EQ((int) taken.size(), 3);
+  ASSERT_TRUE(ranges.isEmpty());
+}
+
+//---[ Mock Device ]--------------------
+// Serial device with a separate memory space which records UVA copies
+typedef std::vector<std::pair<occa::udim_t, occa::udim_t> > copyVector;
+
+static copyVector copiesToDevice;
+static copyVector copiesToHost;
+
+class mockMemory : public occa::serial::memory {
+public:
+  mockMemory(occa::modeDevice_t *modeDevice_,
+             occa::udim_t size_,
+             const occa::properties &properties_) :
+    occa::serial::memory(modeDevice_, size_, properties_) {}
+
+  using occa::serial::memory::copyFrom;
+
+  void copyTo(void *dest,
+              const occa::udim_t bytes,
+              const occa::udim_t destOffset,
+              const occa::properties &props) const {
+    copiesToHost.push_back(std::make_pair(destOffset, bytes));
+    occa::serial::memory::copyTo(dest, bytes, destOffset, props);
+  }
+
+  void copyFrom(const void *src,
+                const occa::udim_t bytes,
+                const occa::udim_t offset,
+                const occa::properties &props) {
+    copiesToDevice.push_back(std::make_pair(offset, bytes));
+    occa::serial::memory::copyFrom(src, bytes, offset, props);
+  }
+};
+
+class mockDevice : public occa::serial::device {
+public:
+  mockDevice() :
+    occa::serial::device(occa::properties("mode: 'Serial'")) {}
+
+  bool hasSeparateMemorySpace() const {
+    return true;
+  }
+
+  occa::modeMemory_t* malloc(const occa::udim_t bytes,
+                             const void *src,
+                             const occa::properties &props) {
+    mockMemory *mem = new mockMemory(this, bytes, props);
+    mem->ptr = (char*) occa::sys::malloc(bytes);
+    if (src) {
+      ::memcpy(mem->ptr, src, bytes);
+    }
+    return mem;
+  }
+};
+
+static bool copiedRanges(copyVector &copies,
+                         const copyVector &expected) {
+  const bool matches = (copies == expected);
+  copies.clear();
+  return matches;
+}
+//======================================
+
+void testDirtyRangeSync() {
+  typedef std::pair<occa::udim_t, occa::udim_t> copy_t;
+
+  occa::device device(new mockDevice());
+  device.setStream(device.createStream());
+
+  const int entries = 1024;
+  const occa::udim_t bytes = entries * sizeof(int);
+  int *ptr = (int*) device.umalloc(entries, occa::dtype::int_,
+                                   occa::properties("track_dirty_ranges: true"));
+  occa::modeMemory_t *mem = occa::uvaToMemory(ptr);
+  ASSERT_TRUE(mem->tracksDirtyRanges);
+  ASSERT_EQ(mem->hostDirtyRanges.bytes(), bytes);
+
+  for (int i = 0; i < entries; ++i) {
+    ptr[i] = i;
+  }
+  occa::kernelArg arg(mem);
+  copiesToDevice.clear();
+
+  // First launch copies the whole buffer
+  arg[0].setupForKernelCall(true);
+  ASSERT_TRUE(copiedRanges(copiesToDevice,
+                           copyVector(1, copy_t(0, bytes))));
+  ASSERT_TRUE(mem->inDevice());
+  ASSERT_FALSE(mem->isStale());
+
+  // Only marked host writes are copied, adjacent ranges are coalesced
+  ptr[10] = -1;
+  ptr[11] = -1;
+  ptr[12] = -1;
+  ptr[100] = -1;
+  occa::markDirty(ptr + 10, 2 * sizeof(int));
+  occa::markDirty(ptr + 12, sizeof(int));
+  occa::markDirty(ptr + 100, sizeof(int));
+
+  arg[0].setupForKernelCall(false);
+  copyVector expected;
+  expected.push_back(copy_t(10 * sizeof(int), 3 * sizeof(int)));
+  expected.push_back(copy_t(100 * sizeof(int), sizeof(int)));
+  ASSERT_TRUE(copiedRanges(copiesToDevice, expected));
+  ASSERT_TRUE(mem->isStale());
+
+  // Kernels can write anywhere
+  device.finish();
+  ASSERT_TRUE(copiedRanges(copiesToHost,
+                           copyVector(1, copy_t(0, bytes))));
+  ASSERT_FALSE(mem->isStale());
+  ASSERT_FALSE(mem->inDevice());
+
+  // occa::memcpy marks host writes
+  int values[2] = {-2, -3};
+  occa::memcpy(ptr + 5, values, 2 * sizeof(int));
+  ASSERT_EQ(ptr[6], -3);
+  ASSERT_TRUE(copiesToDevice.empty());
+
+  // Partial syncs leave the rest dirty
+  occa::memory(mem).syncToDevice(sizeof(int), 5 * sizeof(int));
+  ASSERT_TRUE(copiedRanges(copiesToDevice,
+                           copyVector(1, copy_t(5 * sizeof(int), sizeof(int)))));
+
+  arg[0].setupForKernelCall(true);
+  ASSERT_TRUE(copiedRanges(copiesToDevice,
+                           copyVector(1, copy_t(6 * sizeof(int), sizeof(int)))));
+
+  // Copies into device memory only sync the copied range back
+  occa::memcpy(ptr + 200, values, 2 * sizeof(int));
+  ASSERT_TRUE(copiedRanges(copiesToDevice,
+                           copyVector(1, copy_t(200 * sizeof(int), 2 * sizeof(int)))));
+  ASSERT_TRUE(mem->isStale());
+  ASSERT_EQ(ptr[200], 200);
+
+  occa::memory(mem).syncToHost(-1, 0);
+  ASSERT_TRUE(copiedRanges(copiesToHost,
+                           copyVector(1, copy_t(200 * sizeof(int), 2 * sizeof(int)))));
+  ASSERT_EQ(ptr[200], -2);
+  ASSERT_EQ(ptr[201], -3);
+  ASSERT_FALSE(mem->isStale());
+
+  occa::freeUvaPtr(ptr);
+
+  // Untracked memory copies the whole buffer
+  ptr = (int*) device.umalloc(entries, occa::dtype::int_);
+  mem = occa::uvaToMemory(ptr);
+  ASSERT_FALSE(mem->tracksDirtyRanges);
+
+  occa::kernelArg untrackedArg(mem);
+  copiesToDevice.clear();
+  untrackedArg[0].setupForKernelCall(false);
+  device.finish();
+  untrackedArg[0].setupForKernelCall(true);
+  ASSERT_TRUE(copiedRanges(copiesToDevice,
+                           copyVector(2, copy_t(0, bytes))));
+  ASSERT_TRUE(copiedRanges(copiesToHost,
+                           copyVector(1, copy_t(0, bytes))));
+
+  occa::freeUvaPtr(ptr);
+}
+
 void testUva() {
   int *ptr = occa::umalloc<int>(10);
 
@@ -0,0 +1,99 @@
+#include <atomic>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/testing.hpp>
+#include <occa/tools/workStealingPool.hpp>
+
+void testParallelFor();
+void testImbalancedParallelFor();
+void testNestedParallelFor();
+
+int main(const int argc, const char **argv) {
+  testParallelFor();
+  testImbalancedParallelFor();
+  testNestedParallelFor();
+
+  return 0;
+}
+
+void testParallelFor() {
+  occa::workStealingPool pool(4);
+  ASSERT_EQ(4, pool.size());
+
+  const int iterations = 1000;
+  std::vector<int> visits(iterations, 0);
+
+  auto body = [&](const occa::dim_t i) {
+    ++visits[i];
+  };
+
+  const int chunkSizes[3] = {0, 1, 7};
+  for (int c = 0; c < 3; ++c) {
+    pool.parallelFor(iterations,
+                     chunkSizes[c],
+                     occa::parallelForChunk<decltype(body)>,
+                     &body);
+  }
+  // No iterations
+  pool.parallelFor(0,
+                   0,
+                   occa::parallelForChunk<decltype(body)>,
+                   &body);
+
+  for (int i = 0; i < iterations; ++i) {
+    ASSERT_EQ(3, visits[i]);
+  }
+}
+
+void testImbalancedParallelFor() {
+  occa::workStealingPool pool(4);
+
+  // All of the work is in the first thread's share
+  const int iterations = 400;
+  std::atomic<long> sum(0);
+
+  auto body = [&](const occa::dim_t i) {
+    long value = 0;
+    if (i < 100) {
+      for (int j = 0; j < 100000; ++j) {
+        value += (j % 3);
+      }
+      value = (value > 0);
+    } else {
+      value = 1;
+    }
+    sum += value;
+  };
+
+  pool.parallelFor(iterations,
+                   1,
+                   occa::parallelForChunk<decltype(body)>,
+                   &body);
+
+  ASSERT_EQ((long) iterations, sum.load());
+}
+
+void testNestedParallelFor() {
+  const int iterations = 64;
+  std::atomic<int> count(0);
+
+  auto innerBody = [&](const occa::dim_t i) {
+    ++count;
+  };
+
+  auto outerBody = [&](const occa::dim_t i) {
+    // Runs inline
+    occa::parallelFor(iterations,
+                      0,
+                      occa::parallelForChunk<decltype(innerBody)>,
+                      &innerBody);
+  };
+
+  occa::parallelFor(iterations,
+                    1,
+                    occa::parallelForChunk<decltype(outerBody)>,
+                    &outerBody);
+
+  ASSERT_EQ(iterations * iterations, count.load());
+}